@@ -0,0 +1,191 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "dasharray.h"
+
+// Бенчмарк DashArray: склейка множества коротких буферов
+// Сравнивает прежний подход (каждая операция создает новый массив в куче)
+// с append, растущим вдвое, и встроенным буфером для коротких массивов
+
+// Прежняя реализация: копирование по байту и новый массив на каждую склейку
+class LegacyDashArray {
+public:
+    LegacyDashArray(const unsigned char* sourceData, size_t sourceSize)
+        : arraySize(sourceSize), dataArray(new unsigned char[sourceSize]) {
+        for (size_t i = 0; i < arraySize; ++i) {
+            dataArray[i] = sourceData[i];
+        }
+    }
+
+    LegacyDashArray(LegacyDashArray&& other) noexcept
+        : arraySize(other.arraySize), dataArray(other.dataArray) {
+        other.arraySize = 0;
+        other.dataArray = nullptr;
+    }
+
+    LegacyDashArray& operator=(LegacyDashArray&& other) noexcept {
+        std::swap(arraySize, other.arraySize);
+        std::swap(dataArray, other.dataArray);
+        return *this;
+    }
+
+    // Склейка: новый массив нужного размера и побайтовое копирование
+    LegacyDashArray add(const LegacyDashArray& other) const {
+        LegacyDashArray result(nullptr, 0);
+        result.arraySize = arraySize + other.arraySize;
+        result.dataArray = new unsigned char[result.arraySize];
+        for (size_t i = 0; i < arraySize; ++i) {
+            result.dataArray[i] = dataArray[i];
+        }
+        for (size_t i = 0; i < other.arraySize; ++i) {
+            result.dataArray[arraySize + i] = other.dataArray[i];
+        }
+        return result;
+    }
+
+    size_t size() const { return arraySize; }
+
+    ~LegacyDashArray() { delete[] dataArray; }
+
+private:
+    size_t arraySize;
+    unsigned char* dataArray;
+};
+
+template <class Function>
+void measure(const char* name, Function function) {
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    size_t checksum = function();
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+    std::cout << "  " << name << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " мс (результат " << checksum << ")" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t pieceCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    // Прежняя склейка квадратичная - для нее кусков меньше
+    size_t legacyCount = pieceCount < 20000 ? pieceCount : 20000;
+
+    std::vector<std::string> pieces;
+    for (size_t i = 0; i < pieceCount; ++i) {
+        pieces.push_back("token_" + std::to_string(i % 1000));
+    }
+
+    std::cout << "=== Бенчмарк DashArray ===" << std::endl;
+
+    std::cout << "\n1. Склейка " << legacyCount << " коротких буферов:" << std::endl;
+    measure("прежний add (новый массив на каждый шаг)", [&]() {
+        LegacyDashArray result(nullptr, 0);
+        for (size_t i = 0; i < legacyCount; ++i) {
+            LegacyDashArray piece(reinterpret_cast<const unsigned char*>(pieces[i].data()), pieces[i].size());
+            result = result.add(piece);
+        }
+        return result.size();
+    });
+    measure("append с ростом вдвое", [&]() {
+        DashArray result;
+        for (size_t i = 0; i < legacyCount; ++i) {
+            result.append(DashArray(pieces[i]));
+        }
+        return result.size();
+    });
+
+    std::cout << "\n2. Склейка " << pieceCount << " коротких буферов:" << std::endl;
+    measure("append(DashArray(строка))", [&]() {
+        DashArray result;
+        for (size_t i = 0; i < pieceCount; ++i) {
+            result.append(DashArray(pieces[i]));
+        }
+        return result.size();
+    });
+    measure("append(байты) без промежуточного объекта", [&]() {
+        DashArray result;
+        for (size_t i = 0; i < pieceCount; ++i) {
+            result.append(reinterpret_cast<const unsigned char*>(pieces[i].data()), pieces[i].size());
+        }
+        return result.size();
+    });
+    measure("std::string += (для сравнения)", [&]() {
+        std::string result;
+        for (size_t i = 0; i < pieceCount; ++i) {
+            result += pieces[i];
+        }
+        return result.size();
+    });
+
+    std::cout << "\n3. Создание " << pieceCount << " коротких массивов:" << std::endl;
+    measure("прежний (всегда в куче, копирование по байту)", [&]() {
+        size_t total = 0;
+        for (size_t i = 0; i < pieceCount; ++i) {
+            LegacyDashArray piece(reinterpret_cast<const unsigned char*>(pieces[i].data()), pieces[i].size());
+            total += piece.size();
+        }
+        return total;
+    });
+    measure("DashArray (встроенный буфер)", [&]() {
+        size_t total = 0;
+        for (size_t i = 0; i < pieceCount; ++i) {
+            DashArray piece(pieces[i]);
+            total += piece.size() + piece.isSmall();
+        }
+        return total;
+    });
+
+    std::cout << "\n4. Разбиение текста из " << pieceCount << " слов на токены:" << std::endl;
+    DashArray text;
+    for (size_t i = 0; i < pieceCount; ++i) {
+        text.append(DashView(pieces[i]));
+        text.append(static_cast<unsigned char>(' '));
+    }
+    const std::string textString(reinterpret_cast<const char*>(text.data()), text.size());
+    const DashView searchedToken("token_7");
+    // Во всех вариантах вектор токенов резервируется заранее,
+    // чтобы замер показывал стоимость самих токенов, а не перевыделений вектора
+
+    measure("прежний (std::string::substr + DashArray в куче на токен)", [&]() {
+        std::vector<LegacyDashArray> tokens;
+        tokens.reserve(pieceCount);
+        size_t start = 0;
+        size_t matches = 0;
+        while (start < textString.size()) {
+            size_t end = textString.find(' ', start);
+            std::string token = textString.substr(start, end - start);
+            matches += token == "token_7";
+            tokens.push_back(LegacyDashArray(reinterpret_cast<const unsigned char*>(token.data()), token.size()));
+            start = end + 1;
+        }
+        return tokens.size() + matches;
+    });
+    measure("DashArray со встроенным буфером на токен", [&]() {
+        std::vector<DashArray> tokens;
+        tokens.reserve(pieceCount);
+        DashView rest = text.view();
+        size_t matches = 0;
+        while (!rest.empty()) {
+            DashView token = rest.nextToken(' ');
+            matches += token == searchedToken;
+            tokens.push_back(DashArray(token));
+        }
+        return tokens.size() + matches;
+    });
+    measure("DashView (без копирования)", [&]() {
+        std::vector<DashView> tokens;
+        tokens.reserve(pieceCount);
+        DashView rest = text.view();
+        size_t matches = 0;
+        while (!rest.empty()) {
+            DashView token = rest.nextToken(' ');
+            matches += token == searchedToken;
+            tokens.push_back(token);
+        }
+        return tokens.size() + matches;
+    });
+
+    std::cout << "\n=== Бенчмарк завершен ===" << std::endl;
+    return 0;
+}
@@ -2,13 +2,25 @@
 
 #include <string>
 #include <iostream>
+#include <type_traits>
+
+#include "dashview.h"
 
 // Класс DashArray - демонстрация управления динамической памятью
 // Показывает различные конструкторы, включая перемещающий конструктор (C++11)
 // Демонстрирует Правило пяти (Rule of Five) для управления ресурсами
+//
+// Короткое содержимое (до SMALL_BUFFER_SIZE байт) хранится прямо в объекте,
+// без обращения к куче. Длинное - в динамическом массиве с запасом емкости,
+// который растет вдвое, поэтому append работает за амортизированное O(1).
+// Байты копируются и заполняются целыми блоками (memcpy/memset - в стандартной
+// библиотеке они реализованы векторными инструкциями).
 
 class DashArray {
 public:
+    // Размер встроенного буфера для коротких массивов
+    static const size_t SMALL_BUFFER_SIZE = 16;
+
     // === КОНСТРУКТОРЫ ===
     
     // Конструктор по умолчанию
@@ -16,12 +28,29 @@ public:
     
     // Конструктор с заполнением (размер + значение по умолчанию)
     DashArray(const size_t& arraySize, unsigned char defaultValue = 0);
+
+    // Тот же конструктор для любого целого размера. Без него DashArray(0)
+    // неоднозначен: 0 одинаково хорошо преобразуется и в size_t, и в const char*
+    template <class Integer,
+              class = typename std::enable_if<std::is_integral<Integer>::value>::type>
+    DashArray(Integer arraySize, unsigned char defaultValue = 0)
+        : DashArray(static_cast<size_t>(arraySize), defaultValue) {}
     
     // Конструктор из списка инициализации (C++11)
     DashArray(const std::initializer_list<unsigned char>& initialValues);
     
     // Конструктор из строки
     DashArray(const std::string& sourceString);
+    DashArray(const char* sourceString); // nullptr - пустой массив
+#if __cplusplus >= 201703L
+    DashArray(std::string_view sourceString);
+#endif
+
+    // Конструктор из представления: копирует байты, на которые оно указывает
+    explicit DashArray(const DashView& sourceView);
+
+    // Конструктор из произвольного блока байт
+    DashArray(const unsigned char* sourceData, size_t sourceSize);
     
     // === КОПИРУЮЩИЕ И ПЕРЕМЕЩАЮЩИЕ ОПЕРАЦИИ ===
     
@@ -31,19 +60,59 @@ public:
     // Перемещающий конструктор (C++11) - Правило пяти
     DashArray(DashArray&& other) noexcept;
 
+    // Копирующее присваивание (Правило пяти)
+    DashArray& operator=(const DashArray& other);
+
+    // Перемещающее присваивание (C++11) - Правило пяти
+    DashArray& operator=(DashArray&& other) noexcept;
+
     // === ОПЕРАЦИИ С МАССИВАМИ ===
     
-    // Сложение массивов (создает новый массив)
-    DashArray add(const DashArray& other);
+    // Сложение массивов (создает новый массив из байт обоих массивов)
+    DashArray add(const DashArray& other) const;
     
     // Вычитание массивов (может выбрасывать исключение)
     DashArray remove(const DashArray& other);
+
+    // Добавление в конец с амортизированным ростом емкости
+    DashArray& append(const DashArray& other);
+    DashArray& append(const unsigned char* sourceData, size_t sourceSize);
+    DashArray& append(unsigned char value);
+    DashArray& append(const DashView& sourceView);
+
+    // Резервирование емкости не меньше newCapacity байт
+    void reserve(size_t newCapacity);
+
+    // Очистка без освобождения памяти
+    void clear();
     
     // Сравнение массивов по размеру
     bool equals(const DashArray& other) const;
     
     // Вывод массива в поток
-    std::ostream& print(std::ostream& outputStream);
+    std::ostream& print(std::ostream& outputStream) const;
+
+    // === ДОСТУП К ДАННЫМ ===
+
+    size_t size() const { return arraySize; }
+    size_t capacity() const { return arrayCapacity; }
+    bool isSmall() const { return dataArray == smallBuffer; }
+    const unsigned char* data() const { return dataArray; }
+    unsigned char* data() { return dataArray; }
+
+    // === ПРЕДСТАВЛЕНИЯ БЕЗ КОПИРОВАНИЯ ===
+
+    // Представление всего массива
+    DashView view() const { return DashView(dataArray, arraySize); }
+
+    // Представление части массива (как std::string::substr, но без копирования)
+    DashView substr(size_t position, size_t count = DashView::npos) const { return view().substr(position, count); }
+
+    // Представление байт [first, last)
+    DashView slice(size_t first, size_t last) const { return view().slice(first, last); }
+
+    // Включение вывода сообщений из конструкторов и деструктора
+    static void setTrace(bool enabled);
 
     // === ДЕСТРУКТОР ===
     
@@ -51,8 +120,19 @@ public:
     virtual ~DashArray() noexcept;
 
 private:
+    // Выделение памяти под newCapacity байт с сохранением содержимого
+    void grow(size_t newCapacity);
+
+    // Освобождение динамической памяти и возврат к встроенному буферу
+    void release() noexcept;
+
+    // Перенос содержимого other в пустой *this (other остается пустым)
+    void takeFrom(DashArray& other) noexcept;
+
     // === ДАННЫЕ-ЧЛЕНЫ ===
     
     size_t arraySize;           // Размер массива
-    unsigned char* dataArray;   // Указатель на динамический массив
+    size_t arrayCapacity;       // Емкость: сколько байт помещается без перевыделения
+    unsigned char* dataArray;   // Указатель на данные (smallBuffer или динамический массив)
+    unsigned char smallBuffer[SMALL_BUFFER_SIZE]; // Встроенный буфер для коротких массивов
 };
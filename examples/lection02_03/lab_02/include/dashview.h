@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+// Класс DashView - невладеющее представление последовательности байт
+// Хранит только указатель и длину, поэтому создается и копируется бесплатно.
+// substr/slice возвращают представление тех же байт без копирования.
+// Представление действительно, пока жив и не изменялся владелец байт
+// (DashArray, std::string и т.п.) - после append владелец может перевыделить память.
+
+class DashView {
+public:
+    static const size_t npos = static_cast<size_t>(-1);
+
+    // === КОНСТРУКТОРЫ ===
+
+    DashView() : viewData(nullptr), viewSize(0) {}
+
+    DashView(const unsigned char* sourceData, size_t sourceSize)
+        : viewData(sourceData), viewSize(sourceSize) {}
+
+    DashView(const char* sourceString)
+        : viewData(reinterpret_cast<const unsigned char*>(sourceString)), viewSize(std::strlen(sourceString)) {}
+
+    DashView(const std::string& sourceString)
+        : viewData(reinterpret_cast<const unsigned char*>(sourceString.data())), viewSize(sourceString.size()) {}
+
+#if __cplusplus >= 201703L
+    DashView(std::string_view sourceString)
+        : viewData(reinterpret_cast<const unsigned char*>(sourceString.data())), viewSize(sourceString.size()) {}
+#endif
+
+    // === ДОСТУП К ДАННЫМ ===
+
+    const unsigned char* data() const { return viewData; }
+    size_t size() const { return viewSize; }
+    bool empty() const { return viewSize == 0; }
+    const unsigned char* begin() const { return viewData; }
+    const unsigned char* end() const { return viewData + viewSize; }
+
+    unsigned char operator[](size_t index) const { return viewData[index]; }
+
+    // === СРЕЗЫ БЕЗ КОПИРОВАНИЯ ===
+
+    // count байт начиная с position (как std::string::substr)
+    DashView substr(size_t position, size_t count = npos) const {
+        if (position > viewSize) {
+            throw std::out_of_range("DashView::substr: позиция за пределами");
+        }
+        size_t rest = viewSize - position;
+        return DashView(viewData + position, count < rest ? count : rest);
+    }
+
+    // Байты с индексами [first, last)
+    DashView slice(size_t first, size_t last) const {
+        if (first > last || last > viewSize) {
+            throw std::out_of_range("DashView::slice: неверные границы");
+        }
+        return DashView(viewData + first, last - first);
+    }
+
+    void removePrefix(size_t count) {
+        viewData += count;
+        viewSize -= count;
+    }
+
+    void removeSuffix(size_t count) {
+        viewSize -= count;
+    }
+
+    // Позиция первого байта value начиная с from или npos
+    size_t find(unsigned char value, size_t from = 0) const {
+        if (from >= viewSize) {
+            return npos;
+        }
+        const void* found = std::memchr(viewData + from, value, viewSize - from);
+        return found ? static_cast<size_t>(static_cast<const unsigned char*>(found) - viewData) : npos;
+    }
+
+    // Отделение очередного токена до разделителя: возвращает токен,
+    // а само представление укорачивается до остатка после разделителя
+    DashView nextToken(unsigned char delimiter) {
+        size_t position = find(delimiter);
+        DashView token = substr(0, position);
+        removePrefix(position == npos ? viewSize : position + 1);
+        return token;
+    }
+
+    std::string toString() const {
+        return std::string(reinterpret_cast<const char*>(viewData), viewSize);
+    }
+
+    bool operator==(const DashView& other) const {
+        return viewSize == other.viewSize && (viewSize == 0 || std::memcmp(viewData, other.viewData, viewSize) == 0);
+    }
+
+    bool operator!=(const DashView& other) const {
+        return !(*this == other);
+    }
+
+private:
+    const unsigned char* viewData;  // Начало байт (не владеет ими)
+    size_t viewSize;                // Количество байт
+};
@@ -7,6 +7,9 @@
 
 int main() {
     std::cout << "=== Лабораторная работа 2: Класс DashArray ===" << std::endl;
+
+    // Показываем, какие конструкторы и деструкторы вызываются
+    DashArray::setTrace(true);
     
     // === ДЕМОНСТРАЦИЯ РАЗЛИЧНЫХ КОНСТРУКТОРОВ ===
     
@@ -64,6 +67,19 @@ int main() {
         std::cerr << "Перехвачено исключение: " << exception.what() << std::endl;
     }
 
+    // === ДЕМОНСТРАЦИЯ ПРЕДСТАВЛЕНИЙ ===
+
+    std::cout << "\n--- Представления без копирования ---" << std::endl;
+
+    DashArray sentence("one two three");
+    DashView rest = sentence.view();
+    while (!rest.empty()) {
+        // Токены указывают на байты sentence - новые массивы не создаются
+        DashView token = rest.nextToken(' ');
+        std::cout << "Токен: " << token.toString() << std::endl;
+    }
+    std::cout << "Срез [4, 7): " << sentence.slice(4, 7).toString() << std::endl;
+
     std::cout << "\n--- Выход из main() - вызов деструкторов ---" << std::endl;
     
     // Деструкторы вызываются в обратном порядке создания:
@@ -1,80 +1,129 @@
 #include "dasharray.h"
 
+#include <cstring>
+#include <stdexcept>
+
+const size_t DashArray::SMALL_BUFFER_SIZE;
+const size_t DashView::npos;
+
+// Вывод сообщений из конструкторов выключен по умолчанию
+static bool traceEnabled = false;
+
+static void trace(const char* message) {
+    if (traceEnabled) {
+        std::cout << message << std::endl;
+    }
+}
+
+void DashArray::setTrace(bool enabled) {
+    traceEnabled = enabled;
+}
+
 // === РЕАЛИЗАЦИЯ КОНСТРУКТОРОВ ===
 
 // Конструктор по умолчанию
-DashArray::DashArray() : arraySize(0), dataArray(nullptr) {
-    std::cout << "Конструктор по умолчанию" << std::endl;
+DashArray::DashArray() : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор по умолчанию");
 }
 
 // Конструктор с заполнением
-DashArray::DashArray(const size_t& arraySize, unsigned char defaultValue) {
-    std::cout << "Конструктор с заполнением" << std::endl;
-    this->arraySize = arraySize;
-    this->dataArray = new unsigned char[arraySize];
+DashArray::DashArray(const size_t& arraySize, unsigned char defaultValue)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор с заполнением");
+    reserve(arraySize);
     
-    // Заполняем массив значением по умолчанию
-    for (size_t i = 0; i < arraySize; ++i) {
-        this->dataArray[i] = defaultValue;
-    }
+    // Заполняем массив значением по умолчанию одним блоком
+    std::memset(dataArray, defaultValue, arraySize);
+    this->arraySize = arraySize;
 }
 
 // Конструктор из списка инициализации (C++11)
-DashArray::DashArray(const std::initializer_list<unsigned char>& initialValues) {
-    std::cout << "Конструктор из списка инициализации" << std::endl;
-    arraySize = initialValues.size();
-    dataArray = new unsigned char[arraySize];
-    
-    // Копируем значения из списка инициализации
-    size_t index = 0;
-    for (const auto& value : initialValues) {
-        dataArray[index++] = value;
-    }
+DashArray::DashArray(const std::initializer_list<unsigned char>& initialValues)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из списка инициализации");
+    append(initialValues.begin(), initialValues.size());
 }
 
 // Конструктор из строки
-DashArray::DashArray(const std::string& sourceString) {
-    std::cout << "Конструктор из строки" << std::endl;
-    arraySize = sourceString.size();
-    dataArray = new unsigned char[arraySize];
-    
-    // Копируем символы из строки
-    for (size_t i = 0; i < arraySize; ++i) {
-        dataArray[i] = static_cast<unsigned char>(sourceString[i]);
-    }
+DashArray::DashArray(const std::string& sourceString)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из строки");
+    append(reinterpret_cast<const unsigned char*>(sourceString.data()), sourceString.size());
+}
+
+DashArray::DashArray(const char* sourceString)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из строки");
+    if (sourceString != nullptr)
+        append(DashView(sourceString));
+}
+
+#if __cplusplus >= 201703L
+DashArray::DashArray(std::string_view sourceString)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из строки");
+    append(DashView(sourceString));
+}
+#endif
+
+// Конструктор из представления
+DashArray::DashArray(const DashView& sourceView)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из представления");
+    append(sourceView);
+}
+
+// Конструктор из блока байт
+DashArray::DashArray(const unsigned char* sourceData, size_t sourceSize)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Конструктор из блока байт");
+    append(sourceData, sourceSize);
 }
 
 // Копирующий конструктор (глубокое копирование)
-DashArray::DashArray(const DashArray& other) {
-    std::cout << "Копирующий конструктор" << std::endl;
-    arraySize = other.arraySize;
-    dataArray = new unsigned char[arraySize];
-    
-    // Глубокое копирование данных
-    for (size_t i = 0; i < arraySize; ++i) {
-        dataArray[i] = other.dataArray[i];
-    }
+DashArray::DashArray(const DashArray& other)
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Копирующий конструктор");
+    append(other.dataArray, other.arraySize);
 }
 
 // Перемещающий конструктор (C++11) - "крадет" ресурсы
-DashArray::DashArray(DashArray&& other) noexcept {
-    std::cout << "Перемещающий конструктор" << std::endl;
-    
-    // "Крадем" ресурсы у другого объекта
-    arraySize = other.arraySize;
-    dataArray = other.dataArray;
-    
-    // Обнуляем другой объект, чтобы деструктор не освободил память
-    other.arraySize = 0;
-    other.dataArray = nullptr;
+DashArray::DashArray(DashArray&& other) noexcept
+    : arraySize(0), arrayCapacity(SMALL_BUFFER_SIZE), dataArray(smallBuffer) {
+    trace("Перемещающий конструктор");
+    takeFrom(other);
+}
+
+// Копирующее присваивание
+DashArray& DashArray::operator=(const DashArray& other) {
+    trace("Копирующее присваивание");
+    if (this != &other) {
+        // Память переиспользуется, если ее хватает
+        clear();
+        append(other.dataArray, other.arraySize);
+    }
+    return *this;
+}
+
+// Перемещающее присваивание
+DashArray& DashArray::operator=(DashArray&& other) noexcept {
+    trace("Перемещающее присваивание");
+    if (this != &other) {
+        release();
+        takeFrom(other);
+    }
+    return *this;
 }
 
 // === РЕАЛИЗАЦИЯ ОПЕРАЦИЙ ===
 
-// Сложение массивов (создает новый массив)
-DashArray DashArray::add(const DashArray& other) {
-    // Создаем новый массив с размером, равным сумме размеров
-    return DashArray(this->arraySize + other.arraySize, '1');
+// Сложение массивов: новый массив из байт this, за которыми идут байты other
+DashArray DashArray::add(const DashArray& other) const {
+    DashArray result;
+    result.reserve(arraySize + other.arraySize);
+    result.append(dataArray, arraySize);
+    result.append(other.dataArray, other.arraySize);
+    return result;
 }
 
 // Вычитание массивов (может выбрасывать исключение)
@@ -87,35 +136,111 @@ DashArray DashArray::remove(const DashArray& other) {
     // Уменьшаем размер
     arraySize -= other.arraySize;
     
-    // Возвращаем ссылку на текущий объект
+    // Возвращаем копию текущего объекта
     return *this;
 }
 
+// Добавление в конец
+DashArray& DashArray::append(const unsigned char* sourceData, size_t sourceSize) {
+    if (sourceSize == 0) {
+        return *this;
+    }
+    if (arraySize + sourceSize > arrayCapacity) {
+        // Источник может лежать внутри этого же массива - запоминаем смещение
+        bool isSelf = sourceData >= dataArray && sourceData < dataArray + arraySize;
+        size_t selfOffset = isSelf ? static_cast<size_t>(sourceData - dataArray) : 0;
+
+        // Емкость растет минимум вдвое - амортизированное O(1) на байт
+        size_t newCapacity = arrayCapacity * 2;
+        if (newCapacity < arraySize + sourceSize) {
+            newCapacity = arraySize + sourceSize;
+        }
+        grow(newCapacity);
+
+        if (isSelf) {
+            sourceData = dataArray + selfOffset;
+        }
+    }
+    std::memcpy(dataArray + arraySize, sourceData, sourceSize);
+    arraySize += sourceSize;
+    return *this;
+}
+
+DashArray& DashArray::append(const DashArray& other) {
+    return append(other.dataArray, other.arraySize);
+}
+
+DashArray& DashArray::append(const DashView& sourceView) {
+    return append(sourceView.data(), sourceView.size());
+}
+
+DashArray& DashArray::append(unsigned char value) {
+    return append(&value, 1);
+}
+
+void DashArray::reserve(size_t newCapacity) {
+    if (newCapacity > arrayCapacity) {
+        grow(newCapacity);
+    }
+}
+
+void DashArray::clear() {
+    arraySize = 0;
+}
+
 // Сравнение массивов по размеру
 bool DashArray::equals(const DashArray& other) const {
     return arraySize == other.arraySize;
 }
 
-// Вывод массива в поток
-std::ostream& DashArray::print(std::ostream& outputStream) {
-    for (size_t i = 0; i < arraySize; ++i) {
-        outputStream << dataArray[i];
+// Вывод массива в поток одним блоком
+std::ostream& DashArray::print(std::ostream& outputStream) const {
+    return outputStream.write(reinterpret_cast<const char*>(dataArray), static_cast<std::streamsize>(arraySize));
+}
+
+// === ВСПОМОГАТЕЛЬНЫЕ МЕТОДЫ ===
+
+void DashArray::grow(size_t newCapacity) {
+    unsigned char* newData = new unsigned char[newCapacity];
+    std::memcpy(newData, dataArray, arraySize);
+    if (!isSmall()) {
+        delete[] dataArray;
+    }
+    dataArray = newData;
+    arrayCapacity = newCapacity;
+}
+
+void DashArray::release() noexcept {
+    if (!isSmall()) {
+        delete[] dataArray;
     }
-    return outputStream;
+    dataArray = smallBuffer;
+    arrayCapacity = SMALL_BUFFER_SIZE;
+    arraySize = 0;
+}
+
+void DashArray::takeFrom(DashArray& other) noexcept {
+    if (other.isSmall()) {
+        // Встроенный буфер нельзя "украсть" - копируем байты
+        std::memcpy(smallBuffer, other.smallBuffer, other.arraySize);
+    } else {
+        dataArray = other.dataArray;
+        arrayCapacity = other.arrayCapacity;
+    }
+    arraySize = other.arraySize;
+
+    // Обнуляем другой объект, чтобы деструктор не освободил память
+    other.dataArray = other.smallBuffer;
+    other.arrayCapacity = SMALL_BUFFER_SIZE;
+    other.arraySize = 0;
 }
 
 // === РЕАЛИЗАЦИЯ ДЕСТРУКТОРА ===
 
 // Деструктор - освобождает динамическую память
 DashArray::~DashArray() noexcept {
-    std::cout << "Деструктор" << std::endl;
+    trace("Деструктор");
     
     // Освобождаем память, если она была выделена
-    if (dataArray != nullptr) {
-        delete[] dataArray;
-        dataArray = nullptr;
-    }
-    
-    // Обнуляем размер для безопасности
-    arraySize = 0;
-}
\ No newline at end of file
+    release();
+}
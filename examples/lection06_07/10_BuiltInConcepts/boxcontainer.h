@@ -2,23 +2,54 @@
 #define BOX_CONTAINER_H
 
 #include <iostream>
+#include <algorithm>
 #include <concepts>
+#include <functional>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "simd_find.h"
 
 // ============================================================================
 // КОНТЕЙНЕР С ИСПОЛЬЗОВАНИЕМ ВСТРОЕННЫХ КОНЦЕПЦИЙ C++20
 // ============================================================================
 
+// Порядок оставшихся элементов после удаления
+// unordered - дыры заполняются элементами с конца (меньше перемещений)
+// stable    - относительный порядок оставшихся элементов сохраняется
+enum class RemoveOrder { unordered, stable };
+
+// Тип, для которого определен std::hash - только для него можно построить индекс
+template <typename T>
+concept Hashable = requires(const T& value) {
+	{ std::hash<T>{}(value) } -> std::convertible_to<size_t>;
+};
+
 // Класс-шаблон контейнера с ограничениями на тип T
-// Требует, чтобы тип T был конструируемым по умолчанию
+// Требует, чтобы тип T можно было разрушить (std::destructible).
+// Конструктор по умолчанию больше не нужен: память выделяется "сырой",
+// а элементы создаются в ней через placement new только при добавлении
 template <typename T>
-requires std::is_default_constructible_v<T>
+requires std::destructible<T>
 class BoxContainer
 {		
 	// Константы для управления памятью
 	static const size_t DEFAULT_CAPACITY = 5;  
-	static const size_t EXPAND_STEPS = 5;
+	static const size_t GROWTH_FACTOR = 2;  // Во сколько раз растет вместимость
+
+	// Побочный хеш-индекс: значение -> позиции всех его вхождений
+	// Для типов без std::hash индекс не существует (std::monostate)
+	using index_type = std::conditional_t<Hashable<T>,
+		std::unordered_map<T, std::vector<size_t>>, std::monostate>;
 	
 public:
+	// Результат find, если элемент не найден
+	static constexpr size_t npos = static_cast<size_t>(-1);
+
 	// ========================================================================
 	// КОНСТРУКТОРЫ И ДЕСТРУКТОР
 	// ========================================================================
@@ -28,6 +59,9 @@ public:
 	
 	// Конструктор копирования (требует, чтобы T был копируемым)
 	BoxContainer(const BoxContainer& source) requires std::copyable<T>;
+
+	// Конструктор перемещения - забирает массив у источника
+	BoxContainer(BoxContainer&& source) noexcept;
 	
 	// Деструктор
 	~BoxContainer();
@@ -69,14 +103,42 @@ public:
 	// МЕТОДЫ УПРАВЛЕНИЯ ЭЛЕМЕНТАМИ
 	// ========================================================================
 	
+	// Резервирование памяти минимум под new_capacity элементов
+	void reserve(size_t new_capacity);
+
+	// Создание элемента прямо в контейнере из аргументов конструктора T
+	template <typename... Args>
+	T& emplace_back(Args&&... args);
+
 	// Добавление элемента в контейнер
 	void add(const T& item);
+	void add(T&& item);
 	
 	// Удаление одного элемента
 	bool remove_item(const T& item);
 	
-	// Удаление всех вхождений элемента
-	size_t remove_all(const T& item);
+	// Удаление всех вхождений элемента за один проход
+	size_t remove_all(const T& item, RemoveOrder order = RemoveOrder::unordered);
+
+	// Удаление всех элементов, для которых predicate возвращает true, за один проход
+	template <typename Predicate>
+	size_t remove_if(Predicate predicate, RemoveOrder order = RemoveOrder::unordered);
+
+	// ========================================================================
+	// ПОИСК
+	// ========================================================================
+
+	// Индекс первого вхождения элемента или npos
+	// Для арифметических T используется SIMD, при включенном индексе - хеш-таблица
+	size_t find(const T& item) const;
+
+	bool contains(const T& item) const { return find(item) != npos; }
+
+	// Построение побочного хеш-индекса (для больших контейнеров с дорогим ==)
+	// Индекс обновляется всеми изменяющими методами и занимает O(size) памяти
+	void enable_index() requires Hashable<T>;
+	void disable_index() { m_index.reset(); }
+	bool has_index() const { return m_index != nullptr; }
 	
 	// ========================================================================
 	// ОПЕРАТОРЫ
@@ -88,6 +150,9 @@ public:
 	// Оператор присваивания
 	void operator =(const BoxContainer<T>& source);
 	
+	// Оператор перемещающего присваивания
+	void operator =(BoxContainer<T>&& source) noexcept;
+
 private : 
 	// ========================================================================
 	// ВСПОМОГАТЕЛЬНЫЕ МЕТОДЫ
@@ -95,6 +160,22 @@ private :
 	
 	// Расширение вместимости контейнера
 	void expand(size_t new_capacity);	
+
+	// Выделение и освобождение "сырой" памяти без создания объектов
+	static T* allocate(size_t capacity);
+	static void deallocate(T* items, size_t capacity);
+
+	// Разрушение всех элементов (память не освобождается)
+	void destroy_items();
+
+	// Поддержка хеш-индекса в актуальном состоянии
+	void index_insert(size_t position);
+	void index_erase(size_t position);
+	void index_relocate(size_t from, size_t to);
+	void rebuild_index();
+
+	// Перенос элемента с позиции from на позицию to (to уже свободна от значения)
+	void relocate_item(size_t from, size_t to);
 	
 private : 
 	// ========================================================================
@@ -104,6 +185,7 @@ private :
 	T * m_items;        // Указатель на массив элементов
 	size_t m_capacity;  // Текущая вместимость
 	size_t m_size;      // Текущий размер
+	std::unique_ptr<index_type> m_index;  // Хеш-индекс (nullptr, если выключен)
 };
 
 // ============================================================================
@@ -111,7 +193,7 @@ private :
 // ============================================================================
 
 // Оператор + для объединения двух контейнеров
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 BoxContainer<T> operator +(const BoxContainer<T>& left, const BoxContainer<T>& right);
 
 // ============================================================================
@@ -123,34 +205,54 @@ BoxContainer<T> operator +(const BoxContainer<T>& left, const BoxContainer<T>& r
 // ========================================================================
 
 // Конструктор по умолчанию
-template <typename T> requires std::is_default_constructible_v<T>
+// Выделяется только память, элементы не создаются
+template <typename T> requires std::destructible<T>
 BoxContainer<T>::BoxContainer(size_t capacity)
 {
-	m_items = new T[capacity];
+	m_items = allocate(capacity);
 	m_capacity = capacity;
 	m_size = 0;
 }
 
 // Конструктор копирования
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 BoxContainer<T>::BoxContainer(const BoxContainer<T>& source) requires std::copyable<T>
 {
 	// Настройка нового контейнера
-	m_items = new T[source.m_capacity];
+	m_items = allocate(source.m_capacity);
 	m_capacity = source.m_capacity;
+	m_size = 0;
+
+	// Копирование элементов из источника прямо в сырую память
+	try{
+		std::uninitialized_copy(source.m_items, source.m_items + source.m_size, m_items);
+	}catch(...){
+		deallocate(m_items, m_capacity);
+		throw;
+	}
 	m_size = source.m_size;
 	
-	// Копирование элементов из источника
-	for(size_t index{} ; index < source.size(); ++index){
-		m_items[index] = source.m_items[index];
-	}
+	if (source.m_index)
+		m_index = std::make_unique<index_type>(*source.m_index);
+}
+
+// Конструктор перемещения
+template <typename T> requires std::destructible<T>
+BoxContainer<T>::BoxContainer(BoxContainer<T>&& source) noexcept
+	: m_items(source.m_items), m_capacity(source.m_capacity), m_size(source.m_size),
+	  m_index(std::move(source.m_index))
+{
+	source.m_items = nullptr;
+	source.m_capacity = 0;
+	source.m_size = 0;
 }
 
 // Деструктор
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 BoxContainer<T>::~BoxContainer()
 {
-	delete[] m_items;
+	destroy_items();
+	deallocate(m_items, m_capacity);
 }
 
 
@@ -158,25 +260,52 @@ BoxContainer<T>::~BoxContainer()
 // ВСПОМОГАТЕЛЬНЫЕ МЕТОДЫ
 // ========================================================================
 
+template <typename T> requires std::destructible<T>
+T* BoxContainer<T>::allocate(size_t capacity){
+	if (capacity == 0)
+		return nullptr;
+	return std::allocator<T>{}.allocate(capacity);
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::deallocate(T* items, size_t capacity){
+	if (items)
+		std::allocator<T>{}.deallocate(items, capacity);
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::destroy_items(){
+	std::destroy(m_items, m_items + m_size);
+	m_size = 0;
+}
+
 // Расширение вместимости контейнера
-template <typename T> requires std::is_default_constructible_v<T>
+// Элементы переносятся в новую память перемещением, если конструктор
+// перемещения T не бросает исключений, иначе - копированием
+// (тогда при исключении старый массив остается нетронутым)
+template <typename T> requires std::destructible<T>
 void BoxContainer<T>::expand(size_t new_capacity){
-	std::cout << "Expanding to " << new_capacity << std::endl;
-	T *new_items_container;
-
 	if (new_capacity <= m_capacity)
 		return; // Нужная вместимость уже есть
 	
 	// Выделение новой (большей) памяти
-	new_items_container = new T[new_capacity];
+	T* new_items_container = allocate(new_capacity);
 
-	// Копирование элементов из старого массива в новый
-	for(size_t index{} ; index < m_size; ++index){
-		new_items_container[index] = m_items[index];
+	// Перенос элементов из старого массива в новый
+	size_t moved{};
+	try{
+		for( ; moved < m_size; ++moved){
+			::new (static_cast<void*>(new_items_container + moved)) T(std::move_if_noexcept(m_items[moved]));
+		}
+	}catch(...){
+		std::destroy(new_items_container, new_items_container + moved);
+		deallocate(new_items_container, new_capacity);
+		throw;
 	}
 	
-	// Освобождение старого массива
-	delete [ ] m_items;
+	// Разрушение старых элементов и освобождение старого массива
+	std::destroy(m_items, m_items + m_size);
+	deallocate(m_items, m_capacity);
 	
 	// Привязка текущего контейнера к новому массиву
 	m_items = new_items_container;
@@ -189,109 +318,311 @@ void BoxContainer<T>::expand(size_t new_capacity){
 // МЕТОДЫ УПРАВЛЕНИЯ ЭЛЕМЕНТАМИ
 // ========================================================================
 
+// Резервирование памяти
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::reserve(size_t new_capacity){
+	expand(new_capacity);
+}
+
+// Создание элемента на месте
+// Вместимость растет в GROWTH_FACTOR раз, поэтому n добавлений стоят O(n)
+template <typename T> requires std::destructible<T>
+template <typename... Args>
+T& BoxContainer<T>::emplace_back(Args&&... args){
+	if (m_size == m_capacity){
+		// Аргументы могут ссылаться на элемент самого контейнера,
+		// поэтому новый элемент создается до переноса старых
+		size_t new_capacity = m_capacity ? m_capacity * GROWTH_FACTOR : DEFAULT_CAPACITY;
+		T* new_items_container = allocate(new_capacity);
+		try{
+			::new (static_cast<void*>(new_items_container + m_size)) T(std::forward<Args>(args)...);
+		}catch(...){
+			deallocate(new_items_container, new_capacity);
+			throw;
+		}
+
+		size_t moved{};
+		try{
+			for( ; moved < m_size; ++moved){
+				::new (static_cast<void*>(new_items_container + moved)) T(std::move_if_noexcept(m_items[moved]));
+			}
+		}catch(...){
+			std::destroy(new_items_container, new_items_container + moved);
+			std::destroy_at(new_items_container + m_size);
+			deallocate(new_items_container, new_capacity);
+			throw;
+		}
+
+		std::destroy(m_items, m_items + m_size);
+		deallocate(m_items, m_capacity);
+		m_items = new_items_container;
+		m_capacity = new_capacity;
+	}else{
+		::new (static_cast<void*>(m_items + m_size)) T(std::forward<Args>(args)...);
+	}
+	++m_size;
+	index_insert(m_size - 1);
+	return m_items[m_size - 1];
+}
+
 // Добавление элемента в контейнер
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 void BoxContainer<T>::add(const T& item){
-	if (m_size == m_capacity)
-		// Расширение с шагом EXPAND_STEPS для оптимизации вызовов expand
-		expand(m_size + EXPAND_STEPS);
-	m_items[m_size] = item;
-	++m_size;
+	emplace_back(item);
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::add(T&& item){
+	emplace_back(std::move(item));
 }
 
 
 // Удаление одного элемента
-template <typename T> requires std::is_default_constructible_v<T>
+// Найденный элемент заменяется последним, поэтому порядок не сохраняется
+template <typename T> requires std::destructible<T>
 bool BoxContainer<T>::remove_item(const T& item){
 	
 	// Поиск целевого элемента
-	size_t target_index {m_capacity + 999}; // Большое значение вне диапазона текущего массива
-	for(size_t index{0}; index < m_size ; ++index){
-		if (m_items[index] == item){
-			target_index = index;
-			break; // Нет необходимости продолжать цикл
-		}
-	}
-	
-	if(target_index > m_size)
+	size_t index = find(item);
+	if (index == npos)
 		return false; // Элемент не найден в контейнере
 		
-	// Если мы дошли сюда, элемент находится в m_items[target_index]
-	
-	// Замена элемента по индексу последним элементом и уменьшение m_size
-	m_items[target_index] = m_items[m_size-1];
+	// Замена элемента последним элементом и уменьшение m_size
+	index_erase(index);
+	if (index != m_size - 1)
+		relocate_item(m_size - 1, index);
+	std::destroy_at(m_items + m_size - 1);
 	m_size--;
 	return true;
 }
 
 // Удаление всех вхождений элемента
-// Удаление всех - это удаление одного элемента несколько раз,
-// пока не останется ни одного, с подсчетом удаленных элементов
-template <typename T> requires std::is_default_constructible_v<T>
-size_t BoxContainer<T>::remove_all(const T& item){
-	
-	size_t removed_count{};
-	
-	bool item_removed = remove_item(item);
-	if(item_removed)
-		++removed_count;
-	
-	while(item_removed == true){
-		item_removed = remove_item(item);
-		if(item_removed)
-			++ removed_count;
+// Раньше remove_item вызывался в цикле и каждый раз искал с начала - O(n*k).
+// Теперь весь контейнер проходится один раз
+template <typename T> requires std::destructible<T>
+size_t BoxContainer<T>::remove_all(const T& item, RemoveOrder order){
+	
+	// С индексом позиции вхождений уже известны: дыры заполняются с конца за O(k)
+	if constexpr (Hashable<T>){
+		if (m_index && order == RemoveOrder::unordered){
+			auto found = m_index->find(item);
+			if (found == m_index->end())
+				return 0;
+	
+			std::vector<size_t> positions = std::move(found->second);
+			m_index->erase(found);
+			// С конца: к моменту обработки позиции все вхождения правее уже удалены,
+			// поэтому последний элемент контейнера - не искомый
+			std::sort(positions.begin(), positions.end(), std::greater<size_t>());
+			for (size_t position : positions){
+				if (position != m_size - 1)
+					relocate_item(m_size - 1, position);
+				std::destroy_at(m_items + m_size - 1);
+				m_size--;
+			}
+			return positions.size();
+		}
 	}
 	
+	// Для арифметических типов вхождения находятся векторным поиском
+	if constexpr (simd::is_vectorizable_v<T>){
+		if (order == RemoveOrder::unordered && !m_index){
+			size_t index{};
+			size_t last = m_size;
+			while (true){
+				index += simd::find(m_items + index, last - index, item);
+				if (index >= last)
+					break;
+				// На место найденного элемента встает последний и проверяется заново
+				--last;
+				m_items[index] = m_items[last];
+			}
+			size_t removed_count = m_size - last;
+			std::destroy(m_items + last, m_items + m_size);
+			m_size = last;
+			return removed_count;
+		}
+	}
+
+	return remove_if([&item](const T& element){ return element == item; }, order);
+}
+
+// Удаление по условию за один проход
+template <typename T> requires std::destructible<T>
+template <typename Predicate>
+size_t BoxContainer<T>::remove_if(Predicate predicate, RemoveOrder order){
+
+	size_t last = m_size;
+
+	if (order == RemoveOrder::stable){
+		// Оставляемые элементы сдвигаются влево поверх удаляемых
+		size_t write_index{};
+		for (size_t read_index{}; read_index < m_size; ++read_index){
+			if (predicate(m_items[read_index]))
+				continue;
+			if (write_index != read_index)
+				m_items[write_index] = std::move(m_items[read_index]);
+			++write_index;
+		}
+		last = write_index;
+	}else{
+		// Найденный элемент заменяется последним, который проверяется на следующем шаге
+		size_t index{};
+		while (index < last){
+			if (!predicate(m_items[index])){
+				++index;
+				continue;
+			}
+			--last;
+			if (index != last)
+				m_items[index] = std::move(m_items[last]);
+		}
+	}
+
+	size_t removed_count = m_size - last;
+	std::destroy(m_items + last, m_items + m_size);
+	m_size = last;
+
+	// Позиции сдвинулись - индекс проще построить заново
+	if (removed_count)
+		rebuild_index();
 	return removed_count;
 }
 
+// ========================================================================
+// ПОИСК
+// ========================================================================
+
+template <typename T> requires std::destructible<T>
+size_t BoxContainer<T>::find(const T& item) const{
+	if constexpr (Hashable<T>){
+		if (m_index){
+			auto found = m_index->find(item);
+			if (found == m_index->end())
+				return npos;
+			return *std::min_element(found->second.begin(), found->second.end());
+		}
+	}
+
+	size_t index;
+	if constexpr (simd::is_vectorizable_v<T>)
+		index = simd::find(m_items, m_size, item);
+	else
+		index = std::find(m_items, m_items + m_size, item) - m_items;
+	return index == m_size ? npos : index;
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::enable_index() requires Hashable<T>{
+	if (!m_index)
+		m_index = std::make_unique<index_type>();
+	rebuild_index();
+}
+
+// ========================================================================
+// ПОДДЕРЖКА ХЕШ-ИНДЕКСА
+// ========================================================================
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::index_insert(size_t position){
+	if constexpr (Hashable<T>){
+		if (m_index)
+			(*m_index)[m_items[position]].push_back(position);
+	}
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::index_erase(size_t position){
+	if constexpr (Hashable<T>){
+		if (!m_index)
+			return;
+		auto found = m_index->find(m_items[position]);
+		auto& positions = found->second;
+		*std::find(positions.begin(), positions.end(), position) = positions.back();
+		positions.pop_back();
+		if (positions.empty())
+			m_index->erase(found);
+	}
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::index_relocate(size_t from, size_t to){
+	if constexpr (Hashable<T>){
+		if (!m_index)
+			return;
+		auto& positions = m_index->find(m_items[from])->second;
+		*std::find(positions.begin(), positions.end(), from) = to;
+	}
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::rebuild_index(){
+	if constexpr (Hashable<T>){
+		if (!m_index)
+			return;
+		m_index->clear();
+		m_index->reserve(m_size);
+		for (size_t position{}; position < m_size; ++position)
+			(*m_index)[m_items[position]].push_back(position);
+	}
+}
+
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::relocate_item(size_t from, size_t to){
+	index_relocate(from, to);
+	m_items[to] = std::move(m_items[from]);
+}
+
 // ========================================================================
 // ОПЕРАТОРЫ
 // ========================================================================
 
 // Оператор += для добавления элементов из другого контейнера
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 void BoxContainer<T>::operator +=(const BoxContainer<T>& operand){
 	
+	// Количество запоминается заранее: operand может быть самим *this
+	size_t count = operand.m_size;
+
 	// Убеждаемся, что текущий контейнер может вместить новые элементы
-	if( (m_size + operand.size()) > m_capacity)
-		expand(m_size + operand.size());
+	if( (m_size + count) > m_capacity)
+		expand(std::max(m_size + count, m_capacity * GROWTH_FACTOR));
 		
-	// Копирование элементов
-	for(size_t index{} ; index < operand.m_size; ++index){
-		m_items [m_size + index] = operand.m_items[index];
-	}
+	// Копирование элементов (после expand указатель operand.m_items уже актуален)
+	std::uninitialized_copy(operand.m_items, operand.m_items + count, m_items + m_size);
 	
-	m_size += operand.m_size;
+	size_t first_new = m_size;
+	m_size += count;
+	for (size_t position = first_new; position < m_size; ++position)
+		index_insert(position);
 }
 
 // Оператор присваивания
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 void BoxContainer<T>::operator =(const BoxContainer<T>& source){
-	T *new_items;
-
 	// Проверка на самоприсваивание
 	if (this == &source)
             return;
-/*
-	// Если вместимости разные, настраиваем новый внутренний массив,
-	// который соответствует источнику, потому что мы хотим, чтобы объект,
-	// которому присваиваем, максимально соответствовал источнику.
-	*/
-	if (m_capacity != source.m_capacity)
-	{ 
-	    new_items = new T[source.m_capacity];
-	    delete [ ] m_items;
-	    m_items = new_items;
-	    m_capacity = source.m_capacity;
-	}
 	
-	// Копирование элементов из источника
-	for(size_t index{} ; index < source.size(); ++index){
-		m_items[index] = source.m_items[index];
-	}
+	// Копия строится отдельно: если копирование элемента бросит исключение,
+	// текущий контейнер останется нетронутым
+	BoxContainer<T> copy(source);
+	*this = std::move(copy);
+}
 	
-	m_size = source.m_size;
+// Оператор перемещающего присваивания
+template <typename T> requires std::destructible<T>
+void BoxContainer<T>::operator =(BoxContainer<T>&& source) noexcept{
+	if (this == &source)
+		return;
+
+	destroy_items();
+	deallocate(m_items, m_capacity);
+
+	m_items = std::exchange(source.m_items, nullptr);
+	m_capacity = std::exchange(source.m_capacity, 0);
+	m_size = std::exchange(source.m_size, 0);
+	m_index = std::move(source.m_index);
 }
 
 // ========================================================================
@@ -299,7 +630,7 @@ void BoxContainer<T>::operator =(const BoxContainer<T>& source){
 // ========================================================================
 
 // Оператор + для объединения двух контейнеров
-template <typename T> requires std::is_default_constructible_v<T>
+template <typename T> requires std::destructible<T>
 BoxContainer<T> operator +(const BoxContainer<T>& left, const BoxContainer<T>& right){
 	BoxContainer<T> result(left.size( ) + right.size( ));
 	result += left; 
@@ -0,0 +1,202 @@
+#ifndef SIMD_FIND_H
+#define SIMD_FIND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SIMD_FIND_X86 1
+#include <immintrin.h>
+#endif
+
+// ============================================================================
+// ПОИСК ЗНАЧЕНИЯ В МАССИВЕ С ПОМОЩЬЮ SIMD
+// ============================================================================
+
+// Векторные ядра сравнивают сразу 16 (SSE) или 32 (AVX2) байта за инструкцию.
+// Набор инструкций выбирается во время выполнения по возможностям процессора,
+// поэтому программа собирается без -mavx2 и работает на любом x86-64.
+// На других архитектурах используется обычный цикл.
+
+namespace simd {
+
+// Типы, для которых есть векторное ядро: арифметические размером 1, 2, 4 или 8 байт
+template <typename T>
+inline constexpr bool is_vectorizable_v = std::is_arithmetic_v<T>
+	&& (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+	&& !std::is_same_v<T, long double>;
+
+// Скалярный вариант: индекс первого элемента, равного value, или size
+template <typename T>
+size_t find_scalar(const T* data, size_t size, T value){
+	for (size_t index{}; index < size; ++index){
+		if (data[index] == value)
+			return index;
+	}
+	return size;
+}
+
+#ifdef SIMD_FIND_X86
+namespace detail {
+
+	// Целое того же размера, что и T - для заполнения регистра значением
+	template <typename T>
+	auto as_integer(T value){
+		if constexpr (sizeof(T) == 1){ int8_t bits; std::memcpy(&bits, &value, 1); return bits; }
+		else if constexpr (sizeof(T) == 2){ int16_t bits; std::memcpy(&bits, &value, 2); return bits; }
+		else if constexpr (sizeof(T) == 4){ int32_t bits; std::memcpy(&bits, &value, 4); return bits; }
+		else { int64_t bits; std::memcpy(&bits, &value, 8); return bits; }
+	}
+
+	// ------------------------------------------------------------------------
+	// SSE4.1: 16 байт
+	// ------------------------------------------------------------------------
+
+	template <typename T>
+	__attribute__((target("sse4.1"))) inline __m128i broadcast_sse(T value){
+		if constexpr (std::is_same_v<T, float>) return _mm_castps_si128(_mm_set1_ps(value));
+		else if constexpr (std::is_same_v<T, double>) return _mm_castpd_si128(_mm_set1_pd(value));
+		else if constexpr (sizeof(T) == 1) return _mm_set1_epi8(as_integer(value));
+		else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(as_integer(value));
+		else if constexpr (sizeof(T) == 4) return _mm_set1_epi32(as_integer(value));
+		else return _mm_set1_epi64x(as_integer(value));
+	}
+
+	// Сравнение по правилам operator== для T (для float: -0.0 == 0.0, NaN != NaN)
+	template <typename T>
+	__attribute__((target("sse4.1"))) inline __m128i equal_sse(__m128i block, __m128i needle){
+		if constexpr (std::is_same_v<T, float>)
+			return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(needle)));
+		else if constexpr (std::is_same_v<T, double>)
+			return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(needle)));
+		else if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8(block, needle);
+		else if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(block, needle);
+		else if constexpr (sizeof(T) == 4) return _mm_cmpeq_epi32(block, needle);
+		else return _mm_cmpeq_epi64(block, needle);
+	}
+
+	template <typename T>
+	__attribute__((target("sse4.1"))) size_t find_sse(const T* data, size_t size, T value){
+		constexpr size_t lanes = 16 / sizeof(T);
+		const __m128i needle = broadcast_sse(value);
+
+		size_t index{};
+		for ( ; index + lanes <= size; index += lanes){
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal_sse<T>(block, needle)));
+			if (mask)
+				return index + __builtin_ctz(mask) / sizeof(T);
+		}
+		return index + find_scalar(data + index, size - index, value);
+	}
+
+	// ------------------------------------------------------------------------
+	// AVX2: 32 байта, по четыре регистра за итерацию
+	// ------------------------------------------------------------------------
+
+	template <typename T>
+	__attribute__((target("avx2"))) inline __m256i broadcast_avx2(T value){
+		if constexpr (std::is_same_v<T, float>) return _mm256_castps_si256(_mm256_set1_ps(value));
+		else if constexpr (std::is_same_v<T, double>) return _mm256_castpd_si256(_mm256_set1_pd(value));
+		else if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(as_integer(value));
+		else if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(as_integer(value));
+		else if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(as_integer(value));
+		else return _mm256_set1_epi64x(as_integer(value));
+	}
+
+	template <typename T>
+	__attribute__((target("avx2"))) inline __m256i equal_avx2(__m256i block, __m256i needle){
+		if constexpr (std::is_same_v<T, float>)
+			return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(needle), _CMP_EQ_OQ));
+		else if constexpr (std::is_same_v<T, double>)
+			return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(needle), _CMP_EQ_OQ));
+		else if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(block, needle);
+		else if constexpr (sizeof(T) == 2) return _mm256_cmpeq_epi16(block, needle);
+		else if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(block, needle);
+		else return _mm256_cmpeq_epi64(block, needle);
+	}
+
+	template <typename T>
+	__attribute__((target("avx2"))) inline size_t first_match_avx2(const T* data, __m256i needle){
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+		unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(equal_avx2<T>(block, needle)));
+		return mask ? __builtin_ctz(mask) / sizeof(T) : 32 / sizeof(T);
+	}
+
+	template <typename T>
+	__attribute__((target("avx2"))) size_t find_avx2(const T* data, size_t size, T value){
+		constexpr size_t lanes = 32 / sizeof(T);
+		const __m256i needle = broadcast_avx2(value);
+
+		size_t index{};
+		// Основной цикл: четыре сравнения объединяются через OR,
+		// поэтому на блок из 128 байт приходится одна проверка
+		for ( ; index + 4 * lanes <= size; index += 4 * lanes){
+			const __m256i* block = reinterpret_cast<const __m256i*>(data + index);
+			__m256i any = _mm256_or_si256(
+				_mm256_or_si256(equal_avx2<T>(_mm256_loadu_si256(block), needle),
+				                equal_avx2<T>(_mm256_loadu_si256(block + 1), needle)),
+				_mm256_or_si256(equal_avx2<T>(_mm256_loadu_si256(block + 2), needle),
+				                equal_avx2<T>(_mm256_loadu_si256(block + 3), needle)));
+			if (!_mm256_testz_si256(any, any)){
+				for (size_t part{}; ; part += lanes){
+					size_t offset = first_match_avx2(data + index + part, needle);
+					if (offset < lanes)
+						return index + part + offset;
+				}
+			}
+		}
+		for ( ; index + lanes <= size; index += lanes){
+			size_t offset = first_match_avx2(data + index, needle);
+			if (offset < lanes)
+				return index + offset;
+		}
+		return index + find_scalar(data + index, size - index, value);
+	}
+
+	// Уровень поддержки SIMD определяется один раз при первом вызове
+	enum class Level { scalar, sse41, avx2 };
+
+	inline Level detect_level(){
+		static const Level level = []{
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) return Level::avx2;
+			if (__builtin_cpu_supports("sse4.1")) return Level::sse41;
+			return Level::scalar;
+		}();
+		return level;
+	}
+}
+#endif
+
+// Индекс первого элемента, равного value, или size, если такого нет
+template <typename T>
+requires is_vectorizable_v<T>
+size_t find(const T* data, size_t size, T value){
+#ifdef SIMD_FIND_X86
+	switch (detail::detect_level()){
+		case detail::Level::avx2: return detail::find_avx2(data, size, value);
+		case detail::Level::sse41: return detail::find_sse(data, size, value);
+		default: break;
+	}
+#endif
+	return find_scalar(data, size, value);
+}
+
+// Название выбранного набора инструкций (для вывода в примерах)
+inline const char* level_name(){
+#ifdef SIMD_FIND_X86
+	switch (detail::detect_level()){
+		case detail::Level::avx2: return "AVX2";
+		case detail::Level::sse41: return "SSE4.1";
+		default: break;
+	}
+#endif
+	return "scalar";
+}
+
+} // namespace simd
+
+#endif // SIMD_FIND_H
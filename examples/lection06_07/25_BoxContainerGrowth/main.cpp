@@ -0,0 +1,157 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "../10_BuiltInConcepts/boxcontainer.h"
+
+/**
+ * Прежняя реализация BoxContainer (фрагмент, нужный для добавления)
+ * Вместимость растет на фиксированные EXPAND_STEPS элементов,
+ * новый массив создается через new T[] и заполняется копированием
+ */
+template <typename T>
+requires std::is_default_constructible_v<T>
+class LegacyBoxContainer
+{
+	static const size_t DEFAULT_CAPACITY = 5;
+	static const size_t EXPAND_STEPS = 5;
+
+public:
+	LegacyBoxContainer(size_t capacity = DEFAULT_CAPACITY)
+		: m_items(new T[capacity]), m_capacity(capacity), m_size(0) {}
+
+	~LegacyBoxContainer() { delete[] m_items; }
+
+	LegacyBoxContainer(const LegacyBoxContainer&) = delete;
+	LegacyBoxContainer& operator=(const LegacyBoxContainer&) = delete;
+
+	size_t size() const { return m_size; }
+
+	void add(const T& item){
+		if (m_size == m_capacity)
+			expand(m_size + EXPAND_STEPS);
+		m_items[m_size] = item;
+		++m_size;
+	}
+
+private:
+	void expand(size_t new_capacity){
+		T* new_items_container = new T[new_capacity];
+		for (size_t index{}; index < m_size; ++index)
+			new_items_container[index] = m_items[index];
+		delete[] m_items;
+		m_items = new_items_container;
+		m_capacity = new_capacity;
+	}
+
+	T* m_items;
+	size_t m_capacity;
+	size_t m_size;
+};
+
+/**
+ * Измерение времени count вызовов add (push_back для std::vector)
+ *
+ * @param name - название контейнера для вывода
+ * @param count - количество добавлений
+ * @param make_value - функция, создающая очередной элемент
+ * @return время в миллисекундах
+ */
+template <typename Container, typename MakeValue>
+double measureAdds(const char* name, size_t count, MakeValue make_value){
+	auto start_time = std::chrono::high_resolution_clock::now();
+
+	Container container;
+	for (size_t element_index{}; element_index < count; ++element_index){
+		if constexpr (requires { container.push_back(make_value(element_index)); })
+			container.push_back(make_value(element_index));
+		else
+			container.add(make_value(element_index));
+	}
+
+	auto end_time = std::chrono::high_resolution_clock::now();
+	double milliseconds = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+	std::cout << "   " << name << ": " << milliseconds << " мс (size = " << container.size() << ")" << std::endl;
+	return milliseconds;
+}
+
+/**
+ * Тип без конструктора по умолчанию и с noexcept перемещением
+ * Прежний BoxContainer его не принимал
+ */
+class Ticket {
+public:
+	explicit Ticket(int id) : m_id(id), m_owner("owner_" + std::to_string(id)) {}
+	Ticket(const Ticket&) = default;
+	Ticket(Ticket&&) noexcept = default;
+	Ticket& operator=(const Ticket&) = default;
+	Ticket& operator=(Ticket&&) noexcept = default;
+
+	bool operator==(const Ticket& other) const { return m_id == other.m_id; }
+
+	friend std::ostream& operator<<(std::ostream& output_stream, const Ticket& ticket){
+		return output_stream << "Ticket[" << ticket.m_id << "]";
+	}
+
+private:
+	int m_id;
+	std::string m_owner;
+};
+
+/**
+ * Основная функция - сравнение роста BoxContainer
+ *
+ * Аргументы: [количество элементов] (по умолчанию 10 000 000)
+ */
+int main(int argc, char** argv){
+	size_t element_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+	// Старая реализация квадратичная: на полном объеме она работала бы часами
+	size_t legacy_count = std::min<size_t>(element_count, 100'000);
+
+	std::cout << "=== РОСТ BOXCONTAINER: ФИКСИРОВАННЫЙ ШАГ ПРОТИВ ГЕОМЕТРИЧЕСКОГО ===" << std::endl;
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 1: INT
+	// ========================================================================
+	std::cout << "\n1. int, " << legacy_count << " добавлений:" << std::endl;
+	auto make_int = [](size_t index){ return static_cast<int>(index); };
+	double legacy_time = measureAdds<LegacyBoxContainer<int>>("Старый BoxContainer (+5)", legacy_count, make_int);
+	double box_time = measureAdds<BoxContainer<int>>("Новый BoxContainer (x2)", legacy_count, make_int);
+	measureAdds<std::vector<int>>("std::vector", legacy_count, make_int);
+	std::cout << "   Ускорение относительно старой версии: " << legacy_time / box_time << "x" << std::endl;
+
+	std::cout << "\n2. int, " << element_count << " добавлений:" << std::endl;
+	measureAdds<BoxContainer<int>>("Новый BoxContainer (x2)", element_count, make_int);
+	measureAdds<std::vector<int>>("std::vector", element_count, make_int);
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 2: STD::STRING (ПЕРЕМЕЩЕНИЕ ПРИ РОСТЕ)
+	// ========================================================================
+	size_t string_count = element_count / 10;
+	std::cout << "\n3. std::string, " << legacy_count / 10 << " добавлений:" << std::endl;
+	auto make_string = [](size_t index){ return std::string("element_number_") + std::to_string(index); };
+	legacy_time = measureAdds<LegacyBoxContainer<std::string>>("Старый BoxContainer (+5)", legacy_count / 10, make_string);
+	box_time = measureAdds<BoxContainer<std::string>>("Новый BoxContainer (x2)", legacy_count / 10, make_string);
+	std::cout << "   Ускорение относительно старой версии: " << legacy_time / box_time << "x" << std::endl;
+
+	std::cout << "\n4. std::string, " << string_count << " добавлений:" << std::endl;
+	measureAdds<BoxContainer<std::string>>("Новый BoxContainer (x2)", string_count, make_string);
+	measureAdds<std::vector<std::string>>("std::vector", string_count, make_string);
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 3: RESERVE И EMPLACE_BACK
+	// ========================================================================
+	std::cout << "\n5. reserve + emplace_back для типа без конструктора по умолчанию:" << std::endl;
+	BoxContainer<Ticket> tickets(0);
+	tickets.reserve(4);
+	for (int id = 1; id <= 6; ++id)
+		tickets.emplace_back(id);
+	std::cout << "   " << tickets << std::endl;
+	tickets.remove_item(Ticket(2));
+	std::cout << "   После удаления Ticket[2]: " << tickets << std::endl;
+
+	std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+	return 0;
+}
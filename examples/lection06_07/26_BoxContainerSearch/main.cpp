@@ -0,0 +1,145 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+
+#include "../10_BuiltInConcepts/boxcontainer.h"
+
+/**
+ * Измерение времени выполнения функции
+ *
+ * @param name - название варианта для вывода
+ * @param function - измеряемое действие, возвращает результат для вывода
+ * @return время в миллисекундах
+ */
+template <typename Function>
+double measure(const char* name, Function function){
+	auto start_time = std::chrono::high_resolution_clock::now();
+	auto result = function();
+	auto end_time = std::chrono::high_resolution_clock::now();
+	double milliseconds = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+	std::cout << "   " << name << ": " << milliseconds << " мс (результат: " << result << ")" << std::endl;
+	return milliseconds;
+}
+
+/**
+ * Прежний remove_all: remove_item в цикле, каждый вызов ищет с начала
+ */
+template <typename T>
+size_t removeAllByItems(BoxContainer<T>& container, const T& item){
+	size_t removed_count{};
+	while (container.remove_item(item))
+		++removed_count;
+	return removed_count;
+}
+
+/**
+ * Заполнение контейнера: value(index) для всех элементов,
+ * кроме каждого step-го, на месте которого стоит target
+ */
+template <typename T, typename MakeValue>
+BoxContainer<T> makeContainer(size_t count, size_t step, const T& target, MakeValue make_value){
+	BoxContainer<T> container(0);
+	container.reserve(count);
+	for (size_t element_index{}; element_index < count; ++element_index)
+		container.add(element_index % step == step / 2 ? target : make_value(element_index));
+	return container;
+}
+
+/**
+ * Основная функция - поиск и удаление в BoxContainer
+ *
+ * Аргументы: [количество int] [количество строк]
+ * (по умолчанию 10 000 000 и 2 000 000)
+ */
+int main(int argc, char** argv){
+	size_t int_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+	// Индекс по 10 млн уникальных строк строится несколько секунд, поэтому строк по умолчанию меньше
+	size_t string_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2'000'000;
+	const size_t occurrences = 100;  // Сколько раз удаляемое значение встречается в контейнере
+	const int repeats = 10;
+
+	std::cout << "=== ПОИСК И УДАЛЕНИЕ В BOXCONTAINER ===" << std::endl;
+	std::cout << "Набор инструкций для поиска: " << simd::level_name() << std::endl;
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 1: ПОИСК INT
+	// ========================================================================
+	std::cout << "\n1. Поиск отсутствующего значения среди " << int_count << " int (" << repeats << " раз):" << std::endl;
+	auto make_int = [](size_t index){ return static_cast<int>(index % 1'000'000); };
+	BoxContainer<int> numbers = makeContainer<int>(int_count, int_count + 1, 0, make_int);
+
+	std::vector<int> plain_numbers;
+	for (size_t element_index{}; element_index < numbers.size(); ++element_index)
+		plain_numbers.push_back(numbers.get_item(element_index));
+
+	double scalar_time = measure("Скалярный цикл", [&]{
+		size_t found{};
+		for (int repeat = 0; repeat < repeats; ++repeat)
+			found += simd::find_scalar(plain_numbers.data(), plain_numbers.size(), -1 - repeat);
+		return found / repeats;
+	});
+	double simd_time = measure("BoxContainer::find (SIMD)", [&]{
+		size_t found{};
+		for (int repeat = 0; repeat < repeats; ++repeat)
+			found += numbers.find(-1 - repeat) == numbers.npos;
+		return found;
+	});
+	std::cout << "   Ускорение: " << scalar_time / simd_time << "x" << std::endl;
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 2: УДАЛЕНИЕ ВСЕХ ВХОЖДЕНИЙ INT
+	// ========================================================================
+	std::cout << "\n2. Удаление " << occurrences << " вхождений среди " << int_count << " int:" << std::endl;
+	const int int_target = -7;
+	numbers = makeContainer<int>(int_count, int_count / occurrences, int_target, make_int);
+	{
+		BoxContainer<int> copy(numbers);
+		measure("remove_item в цикле (прежний remove_all)", [&]{ return removeAllByItems(copy, int_target); });
+	}
+	{
+		BoxContainer<int> copy(numbers);
+		measure("remove_all, unordered", [&]{ return copy.remove_all(int_target); });
+	}
+	{
+		BoxContainer<int> copy(numbers);
+		measure("remove_all, stable", [&]{ return copy.remove_all(int_target, RemoveOrder::stable); });
+	}
+	{
+		BoxContainer<int> copy(numbers);
+		measure("remove_if (чётные), stable", [&]{
+			return copy.remove_if([](int value){ return value % 2 == 0; }, RemoveOrder::stable);
+		});
+	}
+	numbers = BoxContainer<int>(0);
+	plain_numbers = {};
+
+	// ========================================================================
+	// ДЕМОНСТРАЦИЯ 3: СТРОКИ И ХЕШ-ИНДЕКС
+	// ========================================================================
+	std::cout << "\n3. Строки: " << string_count << " элементов, " << occurrences << " вхождений удаляемой:" << std::endl;
+	const std::string string_target = "target_string";
+	auto make_string = [](size_t index){ return "item_" + std::to_string(index); };
+	BoxContainer<std::string> strings = makeContainer<std::string>(string_count, string_count / occurrences, string_target, make_string);
+
+	measure("find без индекса", [&]{ return strings.find("missing") == strings.npos; });
+	measure("Построение индекса", [&]{ strings.enable_index(); return strings.has_index(); });
+	measure("find с индексом", [&]{ return strings.find("missing") == strings.npos; });
+
+	std::cout << std::endl;
+	measure("remove_item в цикле, с индексом", [&]{ return removeAllByItems(strings, string_target); });
+
+	strings = makeContainer<std::string>(string_count, string_count / occurrences, string_target, make_string);
+	measure("remove_item в цикле, без индекса", [&]{ return removeAllByItems(strings, string_target); });
+
+	strings = makeContainer<std::string>(string_count, string_count / occurrences, string_target, make_string);
+	measure("remove_all без индекса, unordered", [&]{ return strings.remove_all(string_target); });
+
+	strings = makeContainer<std::string>(string_count, string_count / occurrences, string_target, make_string);
+	strings.enable_index();
+	measure("remove_all с индексом, unordered", [&]{ return strings.remove_all(string_target); });
+	std::cout << "   Значение осталось в контейнере: " << std::boolalpha << strings.contains(string_target) << std::endl;
+
+	std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+	return 0;
+}
@@ -2,71 +2,176 @@
 #include <iostream>
 #include <concepts>
 #include <memory>
+#include <utility>
 #include <assert.h>
 
+// Uncomment to trace constructors, destructor and copy-on-write
+// #define ARRAY_DEBUG
+
+#ifdef ARRAY_DEBUG
+#define ARRAY_LOG(message) (std::cout << message << std::endl)
+#else
+#define ARRAY_LOG(message) ((void)0)
+#endif
+
 template <class T>
 concept Arrayable = std::is_default_constructible<T>::value;
 
-template <Arrayable T>
+// Copy-on-write array with small-buffer optimization.
+//
+// Up to INLINE_CAPACITY elements live inside the object itself, no heap at all.
+// Longer arrays keep elements in a shared_ptr<T[]> that is shared between copies:
+// copying is O(1), and the buffer is cloned only on the first mutable access
+// (non-const operator[] or set()) while somebody else still holds it.
+// A T& returned by the non-const operator[] may be kept and written through
+// later, so after it the buffer becomes unshareable: copies of this Array
+// clone it instead of sharing. set() writes without handing out a reference
+// and keeps the buffer shareable.
+// Like any non-const access, detaching is not safe to race with copies of
+// the same Array object from other threads.
+template <Arrayable T, size_t INLINE_CAPACITY = 4>
 class Array
 {
 public:
     Array() : _size(0), _array{nullptr}
     {
-        std::cout << "Default constructor" << std::endl;
+        ARRAY_LOG("Default constructor");
+    }
+
+    explicit Array(size_t size) : _size(size)
+    {
+        ARRAY_LOG("Size constructor");
+        if (!is_inline())
+            _array = std::shared_ptr<T[]>(new T[_size]);
     }
 
-    Array(const std::initializer_list<T> &t)
+    Array(const std::initializer_list<T> &t) : _size(t.size())
     {
-        std::cout << "Initializer list constructor" << std::endl;
-        _array = std::shared_ptr<T[]>(new T[t.size()]);
+        ARRAY_LOG("Initializer list constructor");
+        if (!is_inline())
+            _array = std::shared_ptr<T[]>(new T[_size]);
+
+        T *items = data();
         size_t i{0};
         for (auto &c : t)
-            _array[i++] = c;
-        _size = t.size();
+            items[i++] = c;
     }
 
-    Array(const Array &other)
+    Array(const Array &other) : _size(other._size)
     {
-        std::cout << "Copy constructor" << std::endl;
-        _size = other._size;
-        _array = std::shared_ptr<T[]>(new T[_size]);
-
-        for (size_t i{0}; i < _size; ++i)
-            _array[i] = other._array[i];
+        ARRAY_LOG("Copy constructor (shared: " << (!is_inline() && !other._unshareable) << ")");
+        if (is_inline())
+            for (size_t i{0}; i < _size; ++i)
+                _inline[i] = other._inline[i];
+        else if (other._unshareable)
+            _array = clone(other._array);
+        else
+            _array = other._array;
     }
 
     Array(Array &&other) noexcept
+        : _size(other._size), _array(std::move(other._array)), _unshareable(std::exchange(other._unshareable, false))
+    {
+        ARRAY_LOG("Move constructor");
+        if (is_inline())
+            for (size_t i{0}; i < _size; ++i)
+                _inline[i] = std::move(other._inline[i]);
+
+        other._size = 0;
+    }
+
+    Array &operator=(const Array &other)
+    {
+        if (this != &other)
+            *this = Array(other);
+        return *this;
+    }
+
+    Array &operator=(Array &&other) noexcept
     {
-        std::cout << "Move constructor" << std::endl;
+        if (this == &other)
+            return *this;
+
+        // release whatever the inline slots still hold
+        for (auto &item : _inline)
+            item = T{};
+
         _size = other._size;
-        _array = other._array;
+        _array = std::move(other._array);
+        _unshareable = std::exchange(other._unshareable, false);
+        if (is_inline())
+            for (size_t i{0}; i < _size; ++i)
+                _inline[i] = std::move(other._inline[i]);
 
         other._size = 0;
-        other._array = nullptr;
+        return *this;
     }
 
+    // mutable access: clones a shared buffer first and stops sharing it with
+    // future copies, since the returned reference may outlive this call
     T& operator[](size_t index){
         assert(index<_size);
-        return _array[index];
+        detach();
+        _unshareable = !is_inline();
+        return data()[index];
+    }
+
+    // write without exposing a reference: the buffer stays shareable
+    void set(size_t index, T value){
+        assert(index<_size);
+        detach();
+        data()[index] = std::move(value);
+    }
+
+    const T& operator[](size_t index) const{
+        assert(index<_size);
+        return data()[index];
     }
 
     size_t size() const{
         return _size;
     }
 
+    // true if the buffer is currently shared with another Array
+    bool is_shared() const{
+        return _array && _array.use_count() > 1;
+    }
+
     ~Array() noexcept
     {
-        std::cout << "destructor:" << _array.use_count() << std::endl;
-        // if (_size > 0)
-        // {
-        //     _size = 0;
-        //     delete[] _array;
-        //     _array = nullptr;
-        // }
+        ARRAY_LOG("destructor:" << _array.use_count());
     }
 
 private:
+    bool is_inline() const{
+        return _size <= INLINE_CAPACITY;
+    }
+
+    T *data(){
+        return is_inline() ? _inline : _array.get();
+    }
+
+    const T *data() const{
+        return is_inline() ? _inline : _array.get();
+    }
+
+    void detach(){
+        if (!is_shared())
+            return;
+
+        ARRAY_LOG("Copy on write");
+        _array = clone(_array);
+    }
+
+    std::shared_ptr<T[]> clone(const std::shared_ptr<T[]> &source) const{
+        std::shared_ptr<T[]> copy(new T[_size]);
+        for (size_t i{0}; i < _size; ++i)
+            copy[i] = source[i];
+        return copy;
+    }
+
     size_t _size;
-    std::shared_ptr<T[]> _array;
-};
\ No newline at end of file
+    std::shared_ptr<T[]> _array;  // used when _size > INLINE_CAPACITY
+    bool _unshareable{false};     // a T& into _array was handed out, copies must clone
+    T _inline[INLINE_CAPACITY]{}; // used when _size <= INLINE_CAPACITY
+};
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include "student.h"
+#include "array.h"
+
+// Array as it was before copy-on-write: every copy clones the buffer on the heap
+template <Arrayable T>
+class EagerArray
+{
+public:
+    explicit EagerArray(size_t size) : _size(size), _array(new T[size])
+    {
+    }
+
+    EagerArray(const EagerArray &other) : _size(other._size), _array(new T[other._size])
+    {
+        for (size_t i{0}; i < _size; ++i)
+            _array[i] = other._array[i];
+    }
+
+    T& operator[](size_t index){
+        return _array[index];
+    }
+
+    const T& operator[](size_t index) const{
+        return _array[index];
+    }
+
+    void set(size_t index, T value){
+        _array[index] = std::move(value);
+    }
+
+    size_t size() const{
+        return _size;
+    }
+
+private:
+    size_t _size;
+    std::shared_ptr<T[]> _array;
+};
+
+using human_ptr = std::shared_ptr<Human<int>>;
+
+template <class Container>
+Container make_people(size_t count)
+{
+    Container people(count);
+    for (size_t i{0}; i < count; ++i)
+        if (i % 2)
+            people.set(i, std::make_shared<Student<int>>(int(i), 1, 2, 3));
+        else
+            people.set(i, std::make_shared<Human<int>>(int(i)));
+    return people;
+}
+
+template <class Function>
+void measure(const char *name, Function function)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t checksum = function();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  " << name << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " ms (checksum " << checksum << ")" << std::endl;
+}
+
+// read-only consumer that takes its own copy, like an API accepting the array by value
+template <class Container>
+size_t count_alive(Container copy)
+{
+    const Container &view = copy;
+    size_t alive{0};
+    for (size_t i{0}; i < view.size(); ++i)
+        alive += view[i] != nullptr;
+    return alive;
+}
+
+// consumer that modifies its copy
+template <class Container>
+size_t drop_first(Container copy)
+{
+    copy[0] = nullptr;
+    return copy.size();
+}
+
+template <class Container>
+void run(const char *name, size_t size, size_t copies)
+{
+    Container source = make_people<Container>(size);
+    std::cout << name << ":" << std::endl;
+    measure("copy + read ", [&] {
+        size_t total{0};
+        for (size_t i{0}; i < copies; ++i)
+            total += count_alive(source);
+        return total;
+    });
+    measure("copy + write", [&] {
+        size_t total{0};
+        for (size_t i{0}; i < copies; ++i)
+            total += drop_first(source);
+        return total;
+    });
+}
+
+int main()
+{
+    const size_t large_size = 1000, large_copies = 100'000;
+    const size_t small_size = 3, small_copies = 5'000'000;
+
+    std::cout << "Large arrays: " << large_size << " elements, " << large_copies << " copies" << std::endl;
+    run<EagerArray<human_ptr>>("EagerArray (deep copy)", large_size, large_copies);
+    run<Array<human_ptr>>("Array (copy-on-write)", large_size, large_copies);
+
+    std::cout << std::endl << "Small arrays: " << small_size << " elements, " << small_copies << " copies" << std::endl;
+    run<EagerArray<human_ptr>>("EagerArray (heap)", small_size, small_copies);
+    run<Array<human_ptr>>("Array (inline buffer)", small_size, small_copies);
+
+    return 0;
+}
@@ -20,6 +20,10 @@ class Human {
 
         }
 
+        const T& get_age() const {
+            return age;
+        }
+
         virtual void print(std::ostream & os) {
             os << *this;
         }
@@ -2,8 +2,10 @@
 #include <string>
 
 #include "student.h"
+#define ARRAY_DEBUG
 #include "array.h"
 #include <memory>
+#include <utility>
 
 int main(){
 
@@ -20,26 +22,28 @@ int main(){
                                     std::make_shared<Student<int>>(1,2,3,4),
                                     std::make_shared<Student<int>>(2,5,8,40),
                                     std::make_shared<Student<int>>(3,6,9,41),
-                                    std::make_shared<Student<int>>(4,7,10,42)
+                                    std::make_shared<Student<int>>(4,7,10,42),
+                                    std::make_shared<Student<int>>(5,8,11,43)
                                 };
 
     for(size_t i=0;i<array.size();++i)
-        std::cout << *array[i] << std::endl;
+        std::cout << *std::as_const(array)[i] << std::endl;
 
     std::cout << "Print ----------------" << std::endl;
 
     for(size_t i=0;i<array.size();++i) {
-         array[i]->print(std::cout);
+         std::as_const(array)[i]->print(std::cout);
          std::cout << std::endl;
     }
 
     Array<std::shared_ptr<Human<int>>> array2 = array;
+    std::cout << "array2 shares buffer with array: " << array2.is_shared() << std::endl;
 
 
     std::cout << "Print array2 ----------------" << std::endl;
 
     for(size_t i=0;i<array2.size();++i) {
-         array2[i]->print(std::cout);
+         std::as_const(array2)[i]->print(std::cout);
          std::cout << std::endl;
     }
 
@@ -49,9 +53,18 @@ int main(){
     std::cout << "Print array3 ----------------" << std::endl;
 
     for(size_t i=0;i<array3.size();++i) {
-         array3[i]->print(std::cout);
+         std::as_const(array3)[i]->print(std::cout);
          std::cout << std::endl;
     }
 
+    // A reference from the non-const operator[] survives the copy below:
+    // the buffer is unshareable from then on, so the copy gets its own
+    std::cout << "Reference kept across a copy ----------------" << std::endl;
+    auto &first = array3[0];
+    Array<std::shared_ptr<Human<int>>> array4 = array3;
+    first = std::make_shared<Student<int>>(9,9,9,9);
+    std::cout << "array3[0]: " << *std::as_const(array3)[0] << std::endl;
+    std::cout << "array4[0]: " << *std::as_const(array4)[0] << std::endl;
+
     return 1;
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+#include "student.h"
+#include "array.h"
+#include "poly_collection.h"
+
+// discards everything, so the measurement is formatting plus dispatch, not I/O
+struct NullBuffer : std::streambuf
+{
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize count) override { return count; }
+};
+
+template <class Function>
+void measure(const char *name, Function function)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    function();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  " << name << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " ms" << std::endl;
+}
+
+// every third object is a plain Human, the rest are Students
+bool is_student(size_t index)
+{
+    return index % 3 != 0;
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    NullBuffer null_buffer;
+    std::ostream null_stream(&null_buffer);
+
+    std::cout << count << " mixed Human<int>/Student<int> objects, print() each" << std::endl;
+
+    Array<std::shared_ptr<Human<int>>> pointers(count);
+    for (size_t i{0}; i < count; ++i)
+        if (is_student(i))
+            pointers[i] = std::make_shared<Student<int>>(int(i), 1, 2, 3);
+        else
+            pointers[i] = std::make_shared<Human<int>>(int(i));
+
+    PolyCollection<Human<int>, Human<int>, Student<int>> collection;
+    collection.reserve<Student<int>>(count);
+    collection.reserve<Human<int>>(count / 3 + 1);
+    for (size_t i{0}; i < count; ++i)
+        if (is_student(i))
+            collection.emplace<Student<int>>(int(i), 1, 2, 3);
+        else
+            collection.emplace<Human<int>>(int(i));
+
+    const auto &shared_array = pointers;
+
+    std::cout << "print() into a null stream:" << std::endl;
+    measure("Array<shared_ptr<Human>>, virtual call", [&] {
+        for (size_t i{0}; i < shared_array.size(); ++i)
+            shared_array[i]->print(null_stream);
+    });
+    measure("PolyCollection, virtual call via Human&", [&] {
+        collection.for_each_base([&](Human<int> &person) { person.print(null_stream); });
+    });
+    measure("PolyCollection, static dispatch", [&] {
+        collection.for_each([&](auto &person) {
+            using Person = std::decay_t<decltype(person)>;
+            person.Person::print(null_stream);
+        });
+    });
+
+    long long age_sum{0};
+    std::cout << "sum of get_age() (memory bound):" << std::endl;
+    measure("Array<shared_ptr<Human>>", [&] {
+        for (size_t i{0}; i < shared_array.size(); ++i)
+            age_sum += shared_array[i]->get_age();
+    });
+    measure("PolyCollection", [&] {
+        collection.for_each([&](auto &person) { age_sum += person.get_age(); });
+    });
+
+    // objects created at different times end up scattered over the heap;
+    // shuffling the pointers models that for the pointer array
+    std::shuffle(&pointers[0], &pointers[0] + count, std::mt19937(42));
+    std::cout << "pointer array after shuffling:" << std::endl;
+    measure("print(), virtual call", [&] {
+        for (size_t i{0}; i < shared_array.size(); ++i)
+            shared_array[i]->print(null_stream);
+    });
+    measure("sum of get_age()", [&] {
+        for (size_t i{0}; i < shared_array.size(); ++i)
+            age_sum += shared_array[i]->get_age();
+    });
+
+    std::cout << "checksum: " << age_sum << std::endl;
+    return 0;
+}
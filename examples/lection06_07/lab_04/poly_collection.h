@@ -0,0 +1,96 @@
+#pragma once
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Polymorphic collection in the "poly_collection" layout.
+//
+// Instead of one array of pointers to heap objects of mixed types, objects of
+// each concrete type live by value in their own contiguous segment
+// (std::vector<Student<int>>, std::vector<Human<int>>, ...).
+// for_each visits the segments one after another and passes each object with
+// its exact static type, so the callback can call members without a virtual
+// dispatch (person.Student<int>::print(os)) and the data is read sequentially.
+//
+// Order between objects of different types is not preserved, only inside
+// one segment.
+template <class Base, class... Types>
+    requires(std::derived_from<Types, Base> && ...)
+class PolyCollection
+{
+public:
+    template <class U>
+    static constexpr bool holds = (std::same_as<U, Types> || ...);
+
+    template <class U>
+        requires holds<std::decay_t<U>>
+    void insert(U &&value)
+    {
+        segment<std::decay_t<U>>().push_back(std::forward<U>(value));
+    }
+
+    template <class U, class... Args>
+        requires holds<U>
+    U &emplace(Args &&...args)
+    {
+        return segment<U>().emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <class U>
+        requires holds<U>
+    std::vector<U> &segment()
+    {
+        return std::get<std::vector<U>>(_segments);
+    }
+
+    template <class U>
+        requires holds<U>
+    const std::vector<U> &segment() const
+    {
+        return std::get<std::vector<U>>(_segments);
+    }
+
+    template <class U>
+        requires holds<U>
+    void reserve(size_t count)
+    {
+        segment<U>().reserve(count);
+    }
+
+    size_t size() const
+    {
+        return (segment<Types>().size() + ...);
+    }
+
+    // f is called as f(U&) for every object, segment by segment
+    template <class F>
+    void for_each(F &&f)
+    {
+        (visit_segment(segment<Types>(), f), ...);
+    }
+
+    template <class F>
+    void for_each(F &&f) const
+    {
+        (visit_segment(segment<Types>(), f), ...);
+    }
+
+    // for callbacks that only need the base interface
+    template <class F>
+    void for_each_base(F &&f)
+    {
+        for_each([&f](Base &object) { f(object); });
+    }
+
+private:
+    template <class Segment, class F>
+    static void visit_segment(Segment &objects, F &f)
+    {
+        for (auto &object : objects)
+            f(object);
+    }
+
+    std::tuple<std::vector<Types>...> _segments;
+};
@@ -0,0 +1,207 @@
+#ifndef DYNAMIC_ARRAY_H
+#define DYNAMIC_ARRAY_H
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+/**
+ * Исключение для выхода за границы массива
+ * Выбрасывается при попытке доступа к несуществующему элементу
+ */
+class OutOfBoundException {
+};
+
+/**
+ * Политика доступа с проверкой границ: operator[] выбрасывает OutOfBoundException
+ */
+struct CheckedAccess {
+    static void check(size_t element_index, size_t array_size) {
+        if (element_index >= array_size) {
+            throw OutOfBoundException();
+        }
+    }
+};
+
+/**
+ * Политика доступа без проверки: operator[] - просто обращение по указателю.
+ * Выход за границы - неопределенное поведение, как у std::vector::operator[]
+ */
+struct UncheckedAccess {
+    static void check(size_t, size_t) noexcept {
+    }
+};
+
+/**
+ * Итератор динамического массива - обертка над обычным указателем
+ *
+ * Удовлетворяет std::contiguous_iterator: элементы лежат в памяти подряд,
+ * поэтому алгоритмы могут работать с ними как с массивом (std::to_address,
+ * memmove в std::copy, векторизация циклов). Разыменование не проверяет
+ * границы - за это отвечает только пара begin()/end().
+ *
+ * @tparam ItemType - тип элементов (const ItemType для константного итератора)
+ */
+template <class ItemType>
+class ArrayIterator {
+private:
+    ItemType* element_pointer = nullptr;  // Текущий элемент
+
+public:
+    using iterator_concept = std::contiguous_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<ItemType>;
+    using element_type = ItemType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ItemType*;
+    using reference = ItemType&;
+
+    ArrayIterator() = default;
+
+    /**
+     * Конструктор итератора
+     * @param element_pointer - указатель на элемент массива
+     */
+    explicit ArrayIterator(ItemType* element_pointer) : element_pointer(element_pointer) {
+    }
+
+    /**
+     * Неявное преобразование iterator -> const_iterator
+     */
+    template <class OtherType>
+        requires std::is_convertible_v<OtherType*, ItemType*>
+    ArrayIterator(const ArrayIterator<OtherType>& other) : element_pointer(std::to_address(other)) {
+    }
+
+    reference operator*() const { return *element_pointer; }
+    pointer operator->() const { return element_pointer; }
+    reference operator[](difference_type offset) const { return element_pointer[offset]; }
+
+    ArrayIterator& operator++() { ++element_pointer; return *this; }
+    ArrayIterator operator++(int) { ArrayIterator previous = *this; ++element_pointer; return previous; }
+    ArrayIterator& operator--() { --element_pointer; return *this; }
+    ArrayIterator operator--(int) { ArrayIterator previous = *this; --element_pointer; return previous; }
+
+    ArrayIterator& operator+=(difference_type offset) { element_pointer += offset; return *this; }
+    ArrayIterator& operator-=(difference_type offset) { element_pointer -= offset; return *this; }
+
+    friend ArrayIterator operator+(ArrayIterator iterator, difference_type offset) { return iterator += offset; }
+    friend ArrayIterator operator+(difference_type offset, ArrayIterator iterator) { return iterator += offset; }
+    friend ArrayIterator operator-(ArrayIterator iterator, difference_type offset) { return iterator -= offset; }
+    friend difference_type operator-(const ArrayIterator& left, const ArrayIterator& right) {
+        return left.element_pointer - right.element_pointer;
+    }
+
+    bool operator==(const ArrayIterator& other) const = default;
+    auto operator<=>(const ArrayIterator& other) const = default;
+};
+
+/**
+ * Динамический массив фиксированного размера
+ *
+ * Итератор - указатель на элементы, поэтому обход range-based for и
+ * алгоритмами std::ranges ничего не проверяет и векторизуется компилятором.
+ * Проверка границ осталась только в доступе по индексу и выбирается
+ * политикой: CheckedAccess (по умолчанию) или UncheckedAccess.
+ * Метод at() проверяет границы всегда, как у стандартных контейнеров.
+ *
+ * @tparam T - тип элементов массива
+ * @tparam AccessPolicy - политика проверки индекса в operator[]
+ */
+template <class T, class AccessPolicy = CheckedAccess>
+class DynamicArray {
+private:
+    std::unique_ptr<T[]> data_pointer;  // Умный указатель на данные
+    size_t array_size = 0;              // Размер массива
+
+public:
+    using item_type = T;
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = ArrayIterator<T>;
+    using const_iterator = ArrayIterator<const T>;
+
+    DynamicArray() = default;
+
+    /**
+     * Конструктор с заданным размером, элементы инициализируются значением по умолчанию
+     * @param array_size - размер создаваемого массива
+     */
+    explicit DynamicArray(size_t array_size)
+        : data_pointer(std::make_unique<T[]>(array_size)), array_size(array_size) {
+    }
+
+    /**
+     * Конструктор с инициализатором списка
+     * @param initialization_list - список значений для инициализации
+     */
+    DynamicArray(std::initializer_list<T> initialization_list)
+        : DynamicArray(initialization_list.size()) {
+        std::copy(initialization_list.begin(), initialization_list.end(), data_pointer.get());
+    }
+
+    DynamicArray(DynamicArray&&) noexcept = default;
+    DynamicArray& operator=(DynamicArray&&) noexcept = default;
+
+    /**
+     * Оператор доступа к элементам по индексу
+     * @param element_index - индекс элемента
+     * @return ссылка на элемент массива
+     * @throws OutOfBoundException если индекс выходит за границы (только CheckedAccess)
+     */
+    T& operator[](size_t element_index) {
+        AccessPolicy::check(element_index, array_size);
+        return data_pointer[element_index];
+    }
+
+    const T& operator[](size_t element_index) const {
+        AccessPolicy::check(element_index, array_size);
+        return data_pointer[element_index];
+    }
+
+    /**
+     * Доступ с проверкой границ при любой политике
+     * @throws OutOfBoundException если индекс выходит за границы
+     */
+    T& at(size_t element_index) {
+        CheckedAccess::check(element_index, array_size);
+        return data_pointer[element_index];
+    }
+
+    const T& at(size_t element_index) const {
+        CheckedAccess::check(element_index, array_size);
+        return data_pointer[element_index];
+    }
+
+    T* data() noexcept { return data_pointer.get(); }
+    const T* data() const noexcept { return data_pointer.get(); }
+
+    size_t size() const noexcept { return array_size; }
+    bool empty() const noexcept { return array_size == 0; }
+
+    /**
+     * Итераторы на начало и конец массива
+     */
+    iterator begin() noexcept { return iterator(data_pointer.get()); }
+    iterator end() noexcept { return iterator(data_pointer.get() + array_size); }
+    const_iterator begin() const noexcept { return const_iterator(data_pointer.get()); }
+    const_iterator end() const noexcept { return const_iterator(data_pointer.get() + array_size); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+};
+
+static_assert(std::contiguous_iterator<ArrayIterator<int>>);
+static_assert(std::contiguous_iterator<ArrayIterator<const int>>);
+static_assert(std::ranges::contiguous_range<DynamicArray<int>>);
+static_assert(std::ranges::contiguous_range<const DynamicArray<int, UncheckedAccess>>);
+static_assert(std::ranges::sized_range<DynamicArray<int>>);
+
+#endif // DYNAMIC_ARRAY_H
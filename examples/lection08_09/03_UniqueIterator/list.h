@@ -4,197 +4,270 @@
 #include <memory>
 #include <iostream>
 #include <exception>
+#include <stdexcept>
 #include <iterator>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <algorithm>
 
-template <class T> 
+template <class T>
 class List{
     private:
         struct ListItem{
-            std::unique_ptr<ListItem> next;
+            ListItem* next;
             T value;
-            void push_back(T& value){
-                if(next) next->push_back(value); // рекурсивный вызов
-                 else
-                 {
-                     next =  std::make_unique<ListItem>(ListItem {std::unique_ptr<ListItem>(),value});
-                 }
-            }
+        };
 
-            T& get(size_t index){
-                if( index == 0 ) return value;
-                if( next) return next->get(--index); // рекурсивный вызов
-                throw std::logic_error("Out of bounds"); 
-            }
+        // Пул узлов: узлы нарезаются из блоков, размер блока растет вдвое
+        // (от 16 до 65536 узлов). Освобожденные узлы уходят в список свободных
+        // и переиспользуются, память блоков возвращается только в деструкторе списка
+        class NodePool{
+            private:
+                union Slot{
+                    Slot* next_free;
+                    alignas(ListItem) unsigned char storage[sizeof(ListItem)];
+                };
 
-            void insert(ListItem &prev,size_t index,const T& value){
-                if(index == 0) {
-                    prev.next = std::make_unique<ListItem>(ListItem{std::move(prev.next),value});;
-                    return;
-                } else 
-                if(next) {
-                    return next->insert(*this,--index,value); // рекурсивный вызов
+                static constexpr size_t first_block_size = 16;
+                static constexpr size_t max_block_size = 65536;
+
+                std::vector<std::unique_ptr<Slot[]>> blocks;
+                Slot*  free_list = nullptr;
+                Slot*  block_cursor = nullptr;    // еще не выданная часть последнего блока
+                Slot*  block_end = nullptr;
+                size_t next_block_size = first_block_size;
+
+            public:
+                NodePool() = default;
+                NodePool(NodePool&& other) noexcept
+                    : blocks(std::move(other.blocks)),
+                      free_list(std::exchange(other.free_list, nullptr)),
+                      block_cursor(std::exchange(other.block_cursor, nullptr)),
+                      block_end(std::exchange(other.block_end, nullptr)),
+                      next_block_size(std::exchange(other.next_block_size, first_block_size)){
+                }
+                NodePool& operator=(NodePool&& other) noexcept{
+                    blocks = std::move(other.blocks);
+                    free_list = std::exchange(other.free_list, nullptr);
+                    block_cursor = std::exchange(other.block_cursor, nullptr);
+                    block_end = std::exchange(other.block_end, nullptr);
+                    next_block_size = std::exchange(other.next_block_size, first_block_size);
+                    return *this;
                 }
-                throw std::logic_error("Out of bounds"); 
-            }
 
-            void erase(ListItem &prev,size_t index){
-                if(index == 0) {
-                    prev.next = std::move(next);
-                    return;
-                } else 
-                if(next) {
-                    return next->erase(*this,--index); // рекурсивный вызов
+                void* allocate(){
+                    if(free_list){
+                        Slot* slot = free_list;
+                        free_list = slot->next_free;
+                        return slot;
+                    }
+                    if(block_cursor == block_end){
+                        blocks.push_back(std::make_unique<Slot[]>(next_block_size));
+                        block_cursor = blocks.back().get();
+                        block_end = block_cursor + next_block_size;
+                        next_block_size = std::min(next_block_size * 2, max_block_size);
+                    }
+                    return block_cursor++;
                 }
-                throw std::logic_error("Out of bounds"); 
-            }
 
-            size_t size(){
-                if( next) return next->size()+1;
-                return 1;
-            }
+                void deallocate(void* pointer) noexcept{
+                    Slot* slot = static_cast<Slot*>(pointer);
+                    slot->next_free = free_list;
+                    free_list = slot;
+                }
         };
 
-    std::unique_ptr<ListItem> head;
+        NodePool    pool;
+        ListItem*   head = nullptr;
+        ListItem**  tail = &head;   // ссылка next последнего узла (или head для пустого списка)
+        size_t      count = 0;
+
+        template <class... Args>
+        ListItem* create_item(ListItem* next, Args&&... args){
+            void* memory = pool.allocate();
+            try{
+                return ::new(memory) ListItem{next, T(std::forward<Args>(args)...)};
+            } catch(...){
+                pool.deallocate(memory);
+                throw;
+            }
+        }
+
+        void destroy_item(ListItem* item) noexcept{
+            item->~ListItem();
+            pool.deallocate(item);
+        }
+
     public:
         using value_type = T;
+
+        // Итератор хранит адрес ссылки на узел (head или next предыдущего узла),
+        // а не сам узел. Поэтому insert и erase перед итератором работают за O(1)
+        // без поиска предыдущего элемента: достаточно переписать эту ссылку.
+        // После insert(it) итератор it указывает на вставленный элемент,
+        // после erase(it) - на следующий за удаленным (как раньше с индексами).
         class ListIterator{
             private:
-                List&   list; // ссылка на список
-                size_t  index; // работа через индексы медленее но без инвалидации
+                ListItem** link = nullptr;
                 friend class List;
+
+                explicit ListIterator(ListItem** l) : link(l){
+                }
             public:
-                using difference_type = int ; // в чем меряем расстояние
+                using difference_type = std::ptrdiff_t; // в чем меряем расстояние
                 using value_type = List::value_type;
                 using reference = List::value_type& ;
                 using pointer = List::value_type*;
-                using iterator_category = std::forward_iterator_tag;//std::random_access_iterator_tag;
+                using iterator_category = std::forward_iterator_tag;
 
-                ListIterator(List &l,int i) : list(l), index(i){
-                } 
+                ListIterator() = default;
 
                 ListIterator& operator++(){
-                    ++index;
+                    link = &((*link)->next);
                     return *this;
                 }
 
-                reference operator*(){
-                    return list[index];
+                ListIterator operator++(int){
+                    ListIterator previous = *this;
+                    ++(*this);
+                    return previous;
                 }
 
-                pointer operator->(){
-                    return &list[index];
+                reference operator*() const{
+                    return (*link)->value;
                 }
 
-                bool operator!=(const ListIterator& other) const{
-                    if(index!=other.index) return true;
-                    if(&list!=&(other.list)) return true;
-                    return false;
+                pointer operator->() const{
+                    return &((*link)->value);
                 }
 
                 bool operator==(const ListIterator& other) const{
-                    if(index!=other.index) return false;
-                    if(&list!=&(other.list)) return false;
-                    return true;
+                    return link == other.link;
                 }
 
+                bool operator!=(const ListIterator& other) const{
+                    return link != other.link;
+                }
         };
 
+        List() = default;
 
-        class FastListIterator {
-            friend class List;
+        List(const List& other){
+            for(const ListItem* item = other.head; item; item = item->next) push_back(item->value);
+        }
 
-            private:
-                std::unique_ptr<ListItem> *item;
-            public:                
-                using difference_type = int ; 
-                using value_type = List::value_type;
-                using reference = List::value_type& ;
-                using pointer = List::value_type*;
-                using iterator_category = std::forward_iterator_tag;
+        List(List&& other) noexcept
+            : pool(std::move(other.pool)),
+              head(std::exchange(other.head, nullptr)),
+              tail(head ? std::exchange(other.tail, &other.head) : &head),
+              count(std::exchange(other.count, 0)){
+            other.tail = &other.head;
+        }
 
-                FastListIterator(std::unique_ptr<ListItem>* p) : item(p){};
+        List& operator=(List other) noexcept{
+            swap(other);
+            return *this;
+        }
 
-                FastListIterator& operator++(){
-                    if(item==nullptr) std::cout << "nullptr in ++" << std::endl;
-                    item = &((*item)->next);
-                    return *this;
-                }
+        // Узлы разрушаются в цикле - никакой рекурсии, как у цепочки unique_ptr
+        ~List(){
+            clear();
+        }
 
-                reference operator*(){
-                    return (*item)->value;
-                }
+        void swap(List& other) noexcept{
+            std::swap(pool, other.pool);
+            std::swap(head, other.head);
+            std::swap(count, other.count);
+            std::swap(tail, other.tail);
+            // пустой список ссылается на собственный head
+            if(!head) tail = &head;
+            if(!other.head) other.tail = &other.head;
+        }
 
-                pointer operator->(){
-                    auto p = item->lock();
-                    return &(p->value);
-                }
+        void clear() noexcept{
+            ListItem* item = head;
+            while(item){
+                ListItem* next = item->next;
+                destroy_item(item);
+                item = next;
+            }
+            head = nullptr;
+            tail = &head;
+            count = 0;
+        }
 
-                bool operator!=(const FastListIterator& other) const{
-                    if(other.item!=nullptr) {
-                        if(item!=other.item) return true;
-                    } else return item->get()!=nullptr;
-                    return false;
-                }
+        // Добавление в конец за O(1) благодаря ссылке tail
+        void push_back(const T& value){
+            emplace_back(value);
+        }
 
-                bool operator==(const FastListIterator& other) const{
-                    return !(*this!=other);
-                }
+        void push_back(T&& value){
+            emplace_back(std::move(value));
+        }
 
-        };
+        template <class... Args>
+        T& emplace_back(Args&&... args){
+            ListItem* item = create_item(nullptr, std::forward<Args>(args)...);
+            *tail = item;
+            tail = &item->next;
+            ++count;
+            return item->value;
+        }
+
+        void push_front(const T& value){
+            insert(begin(), value);
+        }
 
-        void push_back(T& value){
-            if(head) {
-                head->push_back(value);
-            } else head = std::make_unique<ListItem>(ListItem {std::unique_ptr<ListItem>(),
-                                                               value});
+        size_t size() const{
+            return count;
         }
 
-        size_t size(){
-            if(!head) return 0;
-            return head->size();
+        bool empty() const{
+            return count == 0;
         }
 
+        // Доступ по индексу остается O(n), но без рекурсии
         T&   operator[](size_t index){
-            if(!head) throw std::logic_error("Out of bounds");
-            return head->get(index);
+            if(index >= count) throw std::logic_error("Out of bounds");
+            ListItem* item = head;
+            while(index--) item = item->next;
+            return item->value;
         }
 
         ListIterator erase(ListIterator iter){
-            if(iter.index==0){
-                head = std::move(head->next);
-            } else {
-                if(head->next) head->next->erase(*head,iter.index-1);
-            }
-
-            if(iter.index<size()) return iter;
-            return ListIterator(*this,size());
+            ListItem* item = *iter.link;
+            if(!item) throw std::logic_error("Out of bounds");
+            *iter.link = item->next;
+            if(!item->next) tail = iter.link; // удален последний узел
+            destroy_item(item);
+            --count;
+            return iter;
         }
 
         ListIterator insert (ListIterator iter, const T& value){
-            if(iter.index==0){
-                head = std::make_unique<ListItem>(
-                            ListItem {std::move(head),value});
-            } else {
-                if(head->next) head->next->insert(*head,iter.index-1, value);
-            }
-            if(iter.index<size()) return iter;
-            return ListIterator(*this,size());
+            return emplace(iter, value);
         }
 
-        ListIterator begin(){
-            return ListIterator(*this,0);
+        ListIterator insert (ListIterator iter, T&& value){
+            return emplace(iter, std::move(value));
         }
 
-        ListIterator end(){
-            return ListIterator(*this,size());
+        template <class... Args>
+        ListIterator emplace(ListIterator iter, Args&&... args){
+            ListItem* item = create_item(*iter.link, std::forward<Args>(args)...);
+            *iter.link = item;
+            if(!item->next) tail = &item->next; // вставка в конец
+            ++count;
+            return iter;
         }
 
-        FastListIterator begin_fast(){
-            return FastListIterator(&this->head);
+        ListIterator begin(){
+            return ListIterator(&head);
         }
 
-        FastListIterator end_fast(){
-            return FastListIterator(nullptr);
+        ListIterator end(){
+            return ListIterator(tail);
         }
 };
-#endif
\ No newline at end of file
+#endif
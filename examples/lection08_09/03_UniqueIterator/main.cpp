@@ -4,8 +4,8 @@
 #include <algorithm>
 
 /**
- * Основная функция - демонстрация пользовательского списка с двумя типами итераторов
- * Показывает работу с обычными итераторами и быстрыми итераторами
+ * Основная функция - демонстрация пользовательского списка с итераторами
+ * Показывает итерацию, алгоритмы STL, вставку и удаление через итераторы
  */
 auto main() -> int {
     std::cout << "=== ДЕМОНСТРАЦИЯ ПОЛЬЗОВАТЕЛЬСКОГО СПИСКА С ИТЕРАТОРАМИ ===" << std::endl;
@@ -40,18 +40,18 @@ auto main() -> int {
     }
 
     // ========================================================================
-    // ДЕМОНСТРАЦИЯ 2: РАБОТА С АЛГОРИТМАМИ STL (ЗАКОММЕНТИРОВАНО)
-    // ========================================================================
-    // Пример использования алгоритма count_if для подсчета квадратов с площадью >= 400
-    // int large_squares_count = std::count_if(square_list.begin(), square_list.end(),
-    //                                         [](const auto& square) -> bool {
-    //                                             std::pair<int,int> dimensions {
-    //                                                 square.c.first - square.a.first,
-    //                                                 square.c.second - square.a.second
-    //                                             };
-    //                                             return (dimensions.first * dimensions.second) >= 400;
-    //                                         });
-    // std::cout << "Квадратов с площадью >= 400: " << large_squares_count << std::endl;
+    // ДЕМОНСТРАЦИЯ 2: РАБОТА С АЛГОРИТМАМИ STL
+    // ========================================================================
+    // Итератор ссылается на узел, поэтому проход алгоритмом - O(n)
+    auto large_squares_count = std::count_if(square_list.begin(), square_list.end(),
+                                             [](const auto& square) -> bool {
+                                                 std::pair<int,int> dimensions {
+                                                     square.c.first - square.a.first,
+                                                     square.c.second - square.a.second
+                                                 };
+                                                 return (dimensions.first * dimensions.second) >= 400;
+                                             });
+    std::cout << "Квадратов с площадью >= 400: " << large_squares_count << std::endl;
 
     // ========================================================================
     // ДЕМОНСТРАЦИЯ 3: ДОСТУП К ЭЛЕМЕНТАМ ЧЕРЕЗ ИТЕРАТОР
@@ -92,20 +92,27 @@ auto main() -> int {
     }
 
     // ========================================================================
-    // ДЕМОНСТРАЦИЯ 7: БЫСТРЫЕ ИТЕРАТОРЫ
+    // ДЕМОНСТРАЦИЯ 7: ИТЕРАЦИЯ С УДАЛЕНИЕМ
     // ========================================================================
-    std::cout << "6. Использование быстрых итераторов:" << std::endl;
-    for (auto fast_iterator = square_list.begin_fast(); 
-         fast_iterator != square_list.end_fast(); ++fast_iterator) {
-        std::cout << *fast_iterator << std::endl;
+    std::cout << "6. Удаление квадратов со стороной 20 во время обхода:" << std::endl;
+    for (auto iterator = square_list.begin(); iterator != square_list.end(); ) {
+        if (iterator->b.first - iterator->a.first == 20)
+            iterator = square_list.erase(iterator);  // O(1), итератор указывает на следующий
+        else
+            ++iterator;
     }
-    
+    square_list.push_back(medium_square);            // O(1) благодаря ссылке на хвост
+    for (auto iterator = square_list.begin(); iterator != square_list.end(); ++iterator) {
+        std::cout << *iterator << std::endl;
+    }
+
     // ========================================================================
     // ДЕМОНСТРАЦИЯ 8: СРАВНЕНИЕ ИТЕРАТОРОВ
     // ========================================================================
-    std::cout << "7. Сравнение быстрых итераторов:" << std::endl;
-    std::cout << "begin_fast() == begin_fast(): " << (square_list.begin_fast() == square_list.begin_fast()) << std::endl;
-    std::cout << "++begin_fast() == begin_fast(): " << (++square_list.begin_fast() == square_list.begin_fast()) << std::endl;
+    std::cout << "7. Сравнение итераторов:" << std::endl;
+    std::cout << "begin() == begin(): " << (square_list.begin() == square_list.begin()) << std::endl;
+    std::cout << "++begin() == begin(): " << (++square_list.begin() == square_list.begin()) << std::endl;
+    std::cout << "Размер списка: " << square_list.size() << std::endl;
 
     std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
     return 0;
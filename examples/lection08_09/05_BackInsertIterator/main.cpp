@@ -1,6 +1,11 @@
 #include <iostream>
 #include <iterator>
 #include <vector>
+#include <list>
+#include <sstream>
+#include <algorithm>
+
+#include "batch_back_inserter.h"
 
 /**
  * Пользовательская реализация back_insert_iterator
@@ -122,6 +127,43 @@ int main(int argc, char** argv) {
     }
     std::cout << std::endl;
 
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ: ПАКЕТНОЕ ДОБАВЛЕНИЕ (BATCH_BACK_INSERTER)
+    // ========================================================================
+    std::cout << "5. Пакетное добавление диапазона известного размера:" << std::endl;
+    std::vector<int> batch_destination;
+    {
+        mai::batch_inserter<std::vector<int>> batch(batch_destination);
+        // Неквалифицированный copy находит по ADL mai::copy: один reserve и один insert
+        copy(std::begin(source_array), std::end(source_array), mai::batch_back_inserter(batch));
+        std::cout << "   После copy: размер = " << batch_destination.size()
+                  << ", емкость = " << batch_destination.capacity() << std::endl;
+    }
+
+    std::cout << "6. Итератор ввода неизвестного размера - через буфер:" << std::endl;
+    std::list<int> list_destination;
+    {
+        std::istringstream numbers_stream("10 20 30 40 50");
+        mai::batch_inserter<std::list<int>, 4> batch(list_destination);
+        std::copy(std::istream_iterator<int>(numbers_stream), std::istream_iterator<int>(),
+                  mai::batch_back_inserter(batch));
+        std::cout << "   До flush (буфер на 4 элемента): размер = " << list_destination.size() << std::endl;
+        batch.flush();
+        std::cout << "   После flush: размер = " << list_destination.size() << std::endl;
+    }
+
+    std::cout << "7. transform с одним reserve:" << std::endl;
+    {
+        mai::batch_inserter<std::vector<int>> batch(batch_destination);
+        transform(std::begin(source_array), std::end(source_array), mai::batch_back_inserter(batch),
+                  [](int element) { return element * 100; });
+    }
+    std::cout << "   Элементы: ";
+    for (int destination_element : batch_destination) {
+        std::cout << destination_element << " ";
+    }
+    std::cout << std::endl;
+
     std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
     return 0;
 }
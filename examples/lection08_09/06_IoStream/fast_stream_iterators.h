@@ -0,0 +1,355 @@
+#ifndef FAST_STREAM_ITERATORS_H
+#define FAST_STREAM_ITERATORS_H
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#define FAST_STREAM_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mai {
+
+    /**
+     * Источник символов для разбора чисел
+     *
+     * std::istream_iterator<double> на каждое значение вызывает operator>>:
+     * sentry, проверки состояния потока, фасеты локали и посимвольное чтение
+     * из streambuf. input_buffer читает поток большими блоками (по умолчанию
+     * 1 МБ) и разбирает числа прямо в памяти через std::from_chars -
+     * без локали и без копирования.
+     *
+     * Второй режим - файл, отображенный в память (mmap): весь файл
+     * доступен как один массив символов, и чтения нет вовсе.
+     *
+     * Формат: числа, разделенные пробельными символами. Разбор прекращается
+     * на первой ошибке, как у istream_iterator; failed() показывает, был ли
+     * конец данных ошибкой разбора.
+     */
+    class input_buffer {
+    private:
+        std::istream* stream = nullptr;     // Источник в режиме потока
+        std::vector<char> storage;          // Блок, прочитанный из потока
+        const char* cursor = nullptr;       // Начало неразобранных данных
+        const char* limit = nullptr;        // Конец прочитанных данных
+        bool exhausted = false;             // Данных в источнике больше нет
+        bool parse_error = false;
+
+        void* mapping = nullptr;            // Режим mmap: отображенный файл
+        size_t mapping_size = 0;
+
+        input_buffer() = default;
+
+        static bool is_space(char symbol) {
+            return symbol == ' ' || symbol == '\n' || symbol == '\t' || symbol == '\r' || symbol == '\f' || symbol == '\v';
+        }
+
+        /**
+         * Дочитать следующий блок. Неразобранный остаток (начало числа,
+         * разрезанного границей блока) переносится в начало буфера
+         * @return false, если источник исчерпан
+         */
+        bool refill() {
+            if (exhausted) return false;
+            size_t remaining = static_cast<size_t>(limit - cursor);
+            size_t offset = static_cast<size_t>(cursor - storage.data());
+            if (remaining == storage.size()) storage.resize(storage.size() * 2);  // Токен длиннее блока
+            std::memmove(storage.data(), storage.data() + offset, remaining);
+
+            std::streamsize received = stream->rdbuf()->sgetn(storage.data() + remaining,
+                                                              static_cast<std::streamsize>(storage.size() - remaining));
+            if (received <= 0) exhausted = true;
+            cursor = storage.data();
+            limit = storage.data() + remaining + std::max<std::streamsize>(received, 0);
+            return received > 0;
+        }
+
+        void release() noexcept {
+#ifdef FAST_STREAM_MMAP
+            if (mapping) munmap(mapping, mapping_size);
+#endif
+            mapping = nullptr;
+        }
+
+    public:
+        /**
+         * Чтение из потока блоками
+         * @param input - поток (файл, std::cin, строковый поток)
+         * @param block_size - размер блока чтения в байтах
+         */
+        explicit input_buffer(std::istream& input, size_t block_size = 1 << 20)
+            : stream(&input), storage(std::max<size_t>(block_size, 64)) {
+            cursor = limit = storage.data();
+        }
+
+        input_buffer(input_buffer&& other) noexcept
+            : stream(std::exchange(other.stream, nullptr)),
+              storage(std::move(other.storage)),
+              cursor(std::exchange(other.cursor, nullptr)),
+              limit(std::exchange(other.limit, nullptr)),
+              exhausted(std::exchange(other.exhausted, true)),
+              parse_error(other.parse_error),
+              mapping(std::exchange(other.mapping, nullptr)),
+              mapping_size(std::exchange(other.mapping_size, 0)) {
+        }
+
+        input_buffer(const input_buffer&) = delete;
+        input_buffer& operator=(const input_buffer&) = delete;
+        input_buffer& operator=(input_buffer&&) = delete;
+
+        ~input_buffer() {
+            release();
+        }
+
+#ifdef FAST_STREAM_MMAP
+        /**
+         * Файл, отображенный в память: данные читаются прямо из страниц файла
+         * @throws std::system_error если файл не открывается
+         */
+        static input_buffer map_file(const std::string& path) {
+            int descriptor = ::open(path.c_str(), O_RDONLY);
+            if (descriptor < 0) throw std::system_error(errno, std::generic_category(), path);
+
+            struct stat file_status;
+            if (::fstat(descriptor, &file_status) != 0) {
+                int error = errno;
+                ::close(descriptor);
+                throw std::system_error(error, std::generic_category(), path);
+            }
+
+            input_buffer buffer;
+            buffer.exhausted = true;
+            buffer.mapping_size = static_cast<size_t>(file_status.st_size);
+            if (buffer.mapping_size > 0) {
+                void* address = ::mmap(nullptr, buffer.mapping_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (address == MAP_FAILED) {
+                    int error = errno;
+                    ::close(descriptor);
+                    throw std::system_error(error, std::generic_category(), path);
+                }
+                ::madvise(address, buffer.mapping_size, MADV_SEQUENTIAL);
+                buffer.mapping = address;
+            }
+            ::close(descriptor);   // Отображение живет и после закрытия файла
+
+            buffer.cursor = static_cast<const char*>(buffer.mapping);
+            buffer.limit = buffer.cursor + buffer.mapping_size;
+            return buffer;
+        }
+#endif
+
+        /**
+         * Разбор следующего числа
+         * @return false в конце данных или при ошибке разбора
+         */
+        template <class T>
+        bool parse(T& value) {
+            for (;;) {
+                while (cursor != limit && is_space(*cursor)) ++cursor;
+                if (cursor == limit) {
+                    if (!refill()) return false;
+                    continue;
+                }
+
+                // Число должно целиком лежать в буфере: если оно упирается
+                // в конец блока, дочитываем следующий блок
+                const char* token_end = cursor;
+                while (token_end != limit && !is_space(*token_end)) ++token_end;
+                if (token_end == limit && !exhausted) {
+                    refill();
+                    continue;
+                }
+
+                // from_chars не принимает '+' перед числом, а operator>> принимает
+                const char* number_begin = cursor;
+                if (*number_begin == '+' && token_end - number_begin > 1 && number_begin[1] != '-') ++number_begin;
+
+                auto [parsed_end, error] = std::from_chars(number_begin, token_end, value);
+                if (error != std::errc() || parsed_end != token_end) {
+                    parse_error = true;
+                    exhausted = true;
+                    cursor = limit;
+                    return false;
+                }
+                cursor = token_end;
+                return true;
+            }
+        }
+
+        bool failed() const noexcept { return parse_error; }
+    };
+
+    /**
+     * Итератор ввода поверх input_buffer - замена std::istream_iterator<T>
+     *
+     * Как и istream_iterator, читает значение при создании и при ++,
+     * итератор по умолчанию - конец данных. Подходит для
+     * std::vector<T>(first, last) и std::copy.
+     *
+     * @tparam T - арифметический тип, поддерживаемый std::from_chars
+     */
+    template <class T>
+    class parse_iterator {
+    private:
+        input_buffer* buffer_pointer = nullptr;   // nullptr - конец данных
+        T current_value{};
+
+        void read() {
+            if (!buffer_pointer->parse(current_value)) buffer_pointer = nullptr;
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        parse_iterator() = default;
+
+        explicit parse_iterator(input_buffer& buffer) : buffer_pointer(&buffer) {
+            read();
+        }
+
+        reference operator*() const { return current_value; }
+        pointer operator->() const { return &current_value; }
+
+        parse_iterator& operator++() {
+            read();
+            return *this;
+        }
+
+        parse_iterator operator++(int) {
+            parse_iterator previous = *this;
+            read();
+            return previous;
+        }
+
+        bool operator==(const parse_iterator& other) const {
+            return buffer_pointer == other.buffer_pointer;
+        }
+    };
+
+    /**
+     * Буфер вывода: числа форматируются std::to_chars прямо в буфер,
+     * в поток уходят блоки целиком
+     *
+     * Числа с плавающей точкой записываются в кратчайшем виде, который
+     * читается обратно в то же значение (у ostream по умолчанию - 6 значащих
+     * цифр). Остаток буфера записывается при flush() и в деструкторе.
+     */
+    class output_buffer {
+    private:
+        std::ostream* stream;
+        std::vector<char> storage;
+        size_t used = 0;
+
+        static constexpr size_t max_number_length = 64;   // С запасом для double и long long
+
+    public:
+        /**
+         * @param output - поток-получатель
+         * @param block_size - размер буфера в байтах
+         */
+        explicit output_buffer(std::ostream& output, size_t block_size = 1 << 16)
+            : stream(&output), storage(std::max(block_size, 2 * max_number_length)) {
+        }
+
+        output_buffer(const output_buffer&) = delete;
+        output_buffer& operator=(const output_buffer&) = delete;
+
+        ~output_buffer() {
+            flush();
+        }
+
+        void flush() {
+            if (used == 0) return;
+            stream->rdbuf()->sputn(storage.data(), static_cast<std::streamsize>(used));
+            used = 0;
+        }
+
+        /**
+         * Запись числа. Шаблон ограничен арифметическими типами, иначе он
+         * точнее подходил бы для строковых литералов, чем write(std::string_view).
+         * char записывается символом, как operator<<
+         */
+        template <class T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, int> = 0>
+        void write(T value) {
+            if (storage.size() - used < max_number_length) flush();
+            char* written_end = std::to_chars(storage.data() + used, storage.data() + storage.size(), value).ptr;
+            used = static_cast<size_t>(written_end - storage.data());
+        }
+
+        void write(char symbol) {
+            if (used == storage.size()) flush();
+            storage[used++] = symbol;
+        }
+
+        void write(std::string_view text) {
+            if (storage.size() - used < text.size()) {
+                flush();
+                if (text.size() > storage.size()) {
+                    stream->rdbuf()->sputn(text.data(), static_cast<std::streamsize>(text.size()));
+                    return;
+                }
+            }
+            std::memcpy(storage.data() + used, text.data(), text.size());
+            used += text.size();
+        }
+    };
+
+    /**
+     * Итератор вывода поверх output_buffer - замена std::ostream_iterator<T>
+     *
+     * @tparam T - арифметический тип, поддерживаемый std::to_chars
+     */
+    template <class T>
+    class format_iterator {
+    private:
+        output_buffer* buffer_pointer;
+        std::string_view delimiter;
+
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        /**
+         * @param buffer - буфер вывода
+         * @param delimiter - разделитель после каждого значения (строка должна жить дольше итератора)
+         */
+        explicit format_iterator(output_buffer& buffer, std::string_view delimiter = "")
+            : buffer_pointer(&buffer), delimiter(delimiter) {
+        }
+
+        format_iterator& operator=(const T& value) {
+            buffer_pointer->write(value);
+            if (!delimiter.empty()) buffer_pointer->write(delimiter);
+            return *this;
+        }
+
+        format_iterator& operator*() { return *this; }
+        format_iterator& operator++() { return *this; }
+        format_iterator operator++(int) { return *this; }
+    };
+}
+
+#endif // FAST_STREAM_ITERATORS_H
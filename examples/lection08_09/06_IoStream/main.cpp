@@ -2,6 +2,9 @@
 #include <iostream>     // std::cin, std::cout
 #include <iterator>     // std::istream_iterator, std::ostream_iterator
 #include <vector>       // std::vector
+#include <sstream>      // std::istringstream
+
+#include "fast_stream_iterators.h"
 
 /**
  * Основная функция - демонстрация потоковых итераторов
@@ -89,6 +92,25 @@ int main() {
     // }
     // std::cout << std::endl;
 
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 4: БЫСТРЫЕ ИТЕРАТОРЫ (FROM_CHARS / TO_CHARS)
+    // ========================================================================
+    // Те же операции без operator>> и локали: поток читается блоками,
+    // числа разбираются std::from_chars и записываются std::to_chars
+    std::cout << "4. parse_iterator и format_iterator:" << std::endl;
+    std::istringstream numbers_stream("3.5 -2 1e3 0.1 42");
+    mai::input_buffer input(numbers_stream);
+    mai::parse_iterator<double> parse_begin(input), parse_end;
+    std::vector<double> parsed_numbers(parse_begin, parse_end);
+
+    std::cout << "   Разобранные значения: ";
+    {
+        mai::output_buffer output(std::cout);
+        std::copy(parsed_numbers.begin(), parsed_numbers.end(),
+                  mai::format_iterator<double>(output, " "));
+    }   // деструктор output_buffer записывает остаток буфера
+    std::cout << std::endl;
+
     std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
     return 0;
 }
\ No newline at end of file
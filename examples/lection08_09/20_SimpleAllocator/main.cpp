@@ -3,7 +3,13 @@
 #include <chrono>
 #include <list>
 #include <map>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <new>
+#include <limits>
 #include <utility>
+#include <algorithm>
 
 // Раскомментируйте для отладочного вывода
 //#define DEBUG
@@ -14,64 +20,187 @@
  */
 namespace mai {
     /**
-     * Простой аллокатор с пулом объектов
-     * Демонстрирует создание аллокатора для оптимизации производительности
-     * 
-     * @tparam T - тип элементов для выделения
+     * Пул блоков фиксированного размера
+     *
+     * Один пул на каждую пару (размер блока, выравнивание) на всю программу.
+     * У каждого потока есть собственный кэш свободных блоков (thread_local),
+     * поэтому allocate/deallocate в обычном случае не используют ни мьютексов,
+     * ни атомарных операций. С общим складом (depot) поток обменивается
+     * только пачками по batch_size блоков - под мьютексом, но редко.
+     *
+     * Когда склад пуст, пул запрашивает у системы новый кусок памяти (chunk);
+     * каждый следующий кусок в два раза больше предыдущего, поэтому жесткого
+     * ограничения на количество объектов нет.
+     *
+     * @tparam BLOCK_SIZE - размер блока в байтах
+     * @tparam ALIGNMENT - выравнивание блока
      */
-    template <class T>
-    class Allocator {
+    template <size_t BLOCK_SIZE, size_t ALIGNMENT>
+    class Pool {
     private:
-        char* used_blocks;        // Буфер для хранения объектов
-        void** free_blocks;       // Массив указателей на свободные блоки
-        uint64_t free_count;      // Количество свободных блоков
+        struct Node {
+            Node* next;
+        };
 
-    public:
-        static constexpr size_t max_count = 500000;  // Максимальное количество объектов
-        using value_type = T;
-        using pointer = T*;
-        using const_pointer = const T*;
-        using size_type = std::size_t;
+        static constexpr size_t batch_size = 64;           // Блоков в одной пачке обмена со складом
+        static constexpr size_t first_chunk_blocks = 1024;  // Размер первого куска
+        static constexpr size_t max_chunk_blocks = 65536;   // Дальше куски не растут
 
         /**
-         * Конструктор аллокатора
-         * Инициализирует пул объектов и массив свободных блоков
+         * Кэш свободных блоков одного потока
+         * При завершении потока все блоки возвращаются на склад
          */
-        Allocator() {
-            used_blocks = (char*)malloc(sizeof(T) * max_count);
-            free_blocks = (void**)malloc(sizeof(void*) * max_count);
+        struct ThreadCache {
+            Node* head = nullptr;
+            size_t count = 0;
 
-            // Инициализация массива свободных блоков
-            for (uint64_t block_index = 0; block_index < max_count; block_index++) {
-                free_blocks[block_index] = used_blocks + block_index * sizeof(T);
+            ~ThreadCache() {
+                if (head) Pool::instance().release_list(head);
             }
-            free_count = max_count;
-            
+        };
+
+        std::mutex depot_mutex;
+        std::vector<Node*> depot;     // Пачки свободных блоков (односвязные списки по batch_size)
+        std::vector<void*> chunks;    // Все куски, полученные у системы
+        char* chunk_cursor = nullptr; // Еще не нарезанная часть последнего куска
+        char* chunk_end = nullptr;
+        size_t next_chunk_blocks = first_chunk_blocks;
+
+        Pool() = default;
+
+        static ThreadCache& cache() {
+            thread_local ThreadCache local_cache;
+            return local_cache;
+        }
+
+        /**
+         * Нарезает batch_size блоков из текущего куска, при необходимости
+         * запрашивает новый кусок. Вызывается под depot_mutex.
+         * Если системе не хватает памяти - ::operator new бросает std::bad_alloc.
+         */
+        Node* carve_batch() {
+            if (chunk_cursor == chunk_end) {
+                size_t bytes = next_chunk_blocks * BLOCK_SIZE;
+                void* chunk = ::operator new(bytes, std::align_val_t(ALIGNMENT));
+                chunks.push_back(chunk);
+                chunk_cursor = static_cast<char*>(chunk);
+                chunk_end = chunk_cursor + bytes;
 #ifdef DEBUG
-            std::cout << "   Аллокатор: память инициализирована" << std::endl;
+                std::cout << "   Пул: новый кусок на " << next_chunk_blocks << " блоков" << std::endl;
 #endif
+                next_chunk_blocks = std::min(next_chunk_blocks * 2, max_chunk_blocks);
+            }
+
+            Node* head = nullptr;
+            for (size_t block_index = 0; block_index < batch_size && chunk_cursor != chunk_end; block_index++) {
+                Node* node = reinterpret_cast<Node*>(chunk_cursor);
+                node->next = head;
+                head = node;
+                chunk_cursor += BLOCK_SIZE;
+            }
+            return head;
         }
 
         /**
-         * Деструктор аллокатора
-         * Освобождает выделенную память и проверяет на утечки
+         * Пополнение пустого кэша потока пачкой со склада
          */
-        ~Allocator() {
-#ifdef DEBUG
-            if (free_count < max_count) {
-                std::cout << "   Аллокатор: Возможна утечка памяти?" << std::endl;
+        void refill(ThreadCache& local_cache) {
+            std::lock_guard<std::mutex> lock(depot_mutex);
+            Node* batch;
+            if (!depot.empty()) {
+                batch = depot.back();
+                depot.pop_back();
             } else {
-                std::cout << "   Аллокатор: Память освобождена" << std::endl;
+                batch = carve_batch();
             }
-#endif
+            local_cache.head = batch;
+            local_cache.count = 0;
+            for (Node* node = batch; node; node = node->next) local_cache.count++;
+        }
+
+        /**
+         * Переполненный кэш потока отдает одну пачку на склад
+         */
+        void flush(ThreadCache& local_cache) {
+            Node* batch = local_cache.head;
+            Node* last = batch;
+            for (size_t block_index = 1; block_index < batch_size; block_index++) last = last->next;
+            local_cache.head = last->next;
+            local_cache.count -= batch_size;
+            last->next = nullptr;
+
+            std::lock_guard<std::mutex> lock(depot_mutex);
+            depot.push_back(batch);
+        }
+
+        void release_list(Node* head) {
+            std::lock_guard<std::mutex> lock(depot_mutex);
+            depot.push_back(head);
+        }
+
+    public:
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
 
-            free(free_blocks);
-            free(used_blocks);
+        ~Pool() {
+            for (void* chunk : chunks) ::operator delete(chunk, std::align_val_t(ALIGNMENT));
+        }
+
+        static Pool& instance() {
+            static Pool pool;
+            return pool;
+        }
 
-            free_blocks = nullptr;
-            used_blocks = nullptr;
+        void* allocate() {
+            ThreadCache& local_cache = cache();
+            if (!local_cache.head) refill(local_cache);
+            Node* node = local_cache.head;
+            local_cache.head = node->next;
+            local_cache.count--;
+            return node;
         }
 
+        void deallocate(void* pointer) {
+            ThreadCache& local_cache = cache();
+            Node* node = static_cast<Node*>(pointer);
+            node->next = local_cache.head;
+            local_cache.head = node;
+            if (++local_cache.count >= 2 * batch_size) flush(local_cache);
+        }
+    };
+
+    /**
+     * Аллокатор с пулом объектов
+     * Демонстрирует создание аллокатора для оптимизации производительности
+     *
+     * Одиночные объекты (n == 1, как в std::list и std::map) берутся из
+     * общего потокобезопасного пула. Массивы (n > 1, как в std::vector)
+     * выделяются обычным ::operator new, поэтому аллокатор работает
+     * с любыми контейнерами.
+     *
+     * @tparam T - тип элементов для выделения
+     */
+    template <class T>
+    class Allocator {
+    private:
+        static constexpr size_t block_alignment = std::max(alignof(T), alignof(void*));
+        static constexpr size_t block_size =
+            (std::max(sizeof(T), sizeof(void*)) + block_alignment - 1) / block_alignment * block_alignment;
+
+        using pool_type = Pool<block_size, block_alignment>;
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = std::size_t;
+        using is_always_equal = std::true_type;  // Все аллокаторы используют общий пул
+
+        Allocator() noexcept = default;
+
+        template <class U>
+        Allocator(const Allocator<U>&) noexcept {}
+
         /**
          * Структура rebind для совместимости с STL
          * Позволяет STL контейнерам создавать аллокаторы для других типов
@@ -82,79 +211,42 @@ namespace mai {
         };
 
         /**
-         * Выделение памяти для одного объекта
-         * ВАЖНО: Данный аллокатор не поддерживает выделение для n > 1
-         * Поэтому с std::vector данный аллокатор работать не будет
-         * 
-         * @param n - количество элементов (игнорируется, всегда 1)
+         * Выделение памяти для n объектов
+         *
+         * @param n - количество элементов
          * @return указатель на выделенную память
+         * @throws std::bad_alloc если памяти нет
          */
         T* allocate(size_t n) {
-            T* result = nullptr;
-            if (free_count > 0) {
-                result = (T*)free_blocks[--free_count];
-#ifdef DEBUG
-                std::cout << "   Аллокатор: Выделено " << (max_count - free_count) 
-                          << " из " << max_count << " Адрес: " << result << std::endl;
-#endif
-            } else {
-                std::cout << "   Аллокатор: Нет свободной памяти :-)" << std::endl;
-            }
-            return result;
+            if (n == 1) return static_cast<T*>(pool_type::instance().allocate());
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
         }
 
         /**
          * Освобождение памяти
-         * Возвращает блок в пул свободных блоков
-         * 
+         * Одиночный блок возвращается в кэш текущего потока
+         *
          * @param pointer - указатель на освобождаемую память
-         * @param n - количество элементов (игнорируется)
-         */
-        void deallocate(T* pointer, size_t) {
-#ifdef DEBUG
-            std::cout << "   Аллокатор: Освобождение блока" << std::endl;
-#endif
-            free_blocks[free_count++] = pointer;
-        }
-
-        /**
-         * Конструирование объекта в выделенной памяти
-         * 
-         * @param p - указатель на память для конструирования
-         * @param args - аргументы конструктора
-         */
-        template <typename U, typename... Args>
-        void construct(U* p, Args&&... args) {
-            new (p) U(std::forward<Args>(args)...);
-        }
-
-        /**
-         * Разрушение объекта
-         * 
-         * @param p - указатель на объект для разрушения
+         * @param n - количество элементов
          */
-        void destroy(pointer p) {
-            p->~T();
+        void deallocate(T* pointer, size_t n) noexcept {
+            if (n == 1) {
+                pool_type::instance().deallocate(pointer);
+                return;
+            }
+            ::operator delete(pointer, std::align_val_t(alignof(T)));
         }
     };
 
     /**
      * Оператор сравнения аллокаторов
-     * Все аллокаторы считаются равными для совместимости со STL
+     * Все аллокаторы равны: память из одного можно вернуть через другой
      */
     template <class T, class U>
-    constexpr bool operator==(const Allocator<T>& lhs, const Allocator<U>& rhs) {
+    constexpr bool operator==(const Allocator<T>&, const Allocator<U>&) noexcept {
         return true;
     }
-
-    /**
-     * Оператор неравенства аллокаторов
-     * Все аллокаторы считаются равными для совместимости со STL
-     */
-    template <typename T, typename U, size_t BLOCK_COUNT>
-    constexpr bool operator!=(const Allocator<T>& lhs, const Allocator<U>& rhs) {
-        return false;
-    }
 }
 
 /**
@@ -165,52 +257,52 @@ struct TestStructure {
     char buffer[1024];  // Буфер для имитации реальных данных
 };
 
+constexpr int element_count = 500000;
+constexpr int thread_count = 16;
+
 /**
- * Тест производительности со стандартным аллокатором
- * Демонстрирует время работы с системным выделением памяти
+ * Заполнение и опустошение списка - одинаково для обоих аллокаторов
+ *
+ * @param count - количество элементов
  */
-void testStandardAllocator() {
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    std::list<TestStructure> standard_list;
-    
-    // Добавление 500,000 элементов
-    for (int element_index = 0; element_index < 500000; element_index++) {
-        standard_list.push_back(TestStructure());
+template <class Allocator>
+void pushAndErase(int count) {
+    std::list<TestStructure, Allocator> test_list;
+
+    // Добавление элементов
+    for (int element_index = 0; element_index < count; element_index++) {
+        test_list.push_back(TestStructure());
     }
-    
+
     // Удаление всех элементов
-    for (int element_index = 0; element_index < 500000; element_index++) {
-        standard_list.erase(standard_list.begin());
+    for (int element_index = 0; element_index < count; element_index++) {
+        test_list.erase(test_list.begin());
     }
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-    std::cout << "   Стандартный аллокатор: " << duration.count() << " микросекунд" << std::endl;
 }
 
 /**
- * Тест производительности с кастомным аллокатором
- * Демонстрирует время работы с пулом объектов
+ * Тест производительности: element_count элементов делятся между threads потоками
+ *
+ * @param name - название аллокатора для вывода
+ * @param threads - количество потоков
  */
-void testCustomAllocator() {
+template <class Allocator>
+void testAllocator(const char* name, int threads) {
     auto start_time = std::chrono::high_resolution_clock::now();
-    
-    std::list<TestStructure, mai::Allocator<TestStructure>> custom_list;
-    
-    // Добавление 500,000 элементов
-    for (int element_index = 0; element_index < 500000; element_index++) {
-        custom_list.push_back(TestStructure());
-    }
-    
-    // Удаление всех элементов
-    for (int element_index = 0; element_index < 500000; element_index++) {
-        custom_list.erase(custom_list.begin());
+
+    if (threads == 1) {
+        pushAndErase<Allocator>(element_count);
+    } else {
+        std::vector<std::thread> workers;
+        for (int thread_index = 0; thread_index < threads; thread_index++) {
+            workers.emplace_back(pushAndErase<Allocator>, element_count / threads);
+        }
+        for (auto& worker : workers) worker.join();
     }
-    
+
     auto end_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-    std::cout << "   Кастомный аллокатор: " << duration.count() << " микросекунд" << std::endl;
+    std::cout << "   " << name << ": " << duration.count() << " микросекунд" << std::endl;
 }
 
 /**
@@ -221,27 +313,34 @@ int main(int argc, char** argv) {
     std::cout << "=== ДЕМОНСТРАЦИЯ ПРОИЗВОДИТЕЛЬНОСТИ АЛЛОКАТОРОВ ===" << std::endl;
 
     // ========================================================================
-    // ДЕМОНСТРАЦИЯ 1: СТАНДАРТНЫЙ АЛЛОКАТОР
+    // ДЕМОНСТРАЦИЯ 1: ОДИН ПОТОК
     // ========================================================================
-    std::cout << "\n1. Тест со стандартным аллокатором:" << std::endl;
-    testStandardAllocator();
+    std::cout << "\n1. Один поток, " << element_count << " элементов:" << std::endl;
+    testAllocator<std::allocator<TestStructure>>("Стандартный аллокатор", 1);
+    testAllocator<mai::Allocator<TestStructure>>("Кастомный аллокатор", 1);
 
     // ========================================================================
-    // ДЕМОНСТРАЦИЯ 2: КАСТОМНЫЙ АЛЛОКАТОР
+    // ДЕМОНСТРАЦИЯ 2: НЕСКОЛЬКО ПОТОКОВ
     // ========================================================================
-    std::cout << "\n2. Тест с кастомным аллокатором:" << std::endl;
-    testCustomAllocator();
+    std::cout << "\n2. " << thread_count << " потоков, всего " << element_count << " элементов:" << std::endl;
+    testAllocator<std::allocator<TestStructure>>("Стандартный аллокатор", thread_count);
+    testAllocator<mai::Allocator<TestStructure>>("Кастомный аллокатор", thread_count);
 
     // ========================================================================
-    // ДЕМОНСТРАЦИЯ 3: ИСПОЛЬЗОВАНИЕ С MAP (ЗАКОММЕНТИРОВАНО)
+    // ДЕМОНСТРАЦИЯ 3: ИСПОЛЬЗОВАНИЕ С MAP И VECTOR
     // ========================================================================
-    std::cout << "\n3. Использование с std::map (закомментировано):" << std::endl;
-    std::cout << "   // std::map<int, int, std::less<int>, mai::Allocator<std::pair<const int, int>>> my_map;" << std::endl;
-    std::cout << "   // my_map[1] = 10;" << std::endl;
-    std::cout << "   // my_map[2] = 20;" << std::endl;
-    std::cout << "   // my_map[3] = 30;" << std::endl;
-    std::cout << "   // for (const auto& [key, value] : my_map)" << std::endl;
-    std::cout << "   //     std::cout << key << \"->\" << value << std::endl;" << std::endl;
+    std::cout << "\n3. Использование с std::map и std::vector:" << std::endl;
+    std::map<int, int, std::less<int>, mai::Allocator<std::pair<const int, int>>> my_map;
+    my_map[1] = 10;
+    my_map[2] = 20;
+    my_map[3] = 30;
+    for (const auto& [key, value] : my_map)
+        std::cout << "   " << key << "->" << value << std::endl;
+
+    std::vector<int, mai::Allocator<int>> my_vector{1, 2, 3, 4, 5};
+    std::cout << "   vector:";
+    for (int value : my_vector) std::cout << " " << value;
+    std::cout << std::endl;
 
     std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
     return 0;
@@ -0,0 +1,121 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <map>
+#include <list>
+#include <deque>
+#include <string>
+#include <memory>
+
+#include "slab_allocator.h"
+
+/**
+ * Набор контейнеров с одним и тем же аллокатором
+ *
+ * @tparam Alloc - шаблон аллокатора (std::allocator или mai::slab_allocator)
+ */
+template <template <class> class Alloc>
+struct containers {
+    using vector_type = std::vector<int, Alloc<int>>;
+    using map_type = std::map<int, int, std::less<int>, Alloc<std::pair<const int, int>>>;
+    using list_type = std::list<int, Alloc<int>>;
+    using deque_type = std::deque<int, Alloc<int>>;
+};
+
+/**
+ * Смешанная нагрузка: вектор растет с перевыделениями, map и list выделяют
+ * узлы поштучно, deque - блоками. Половина элементов удаляется, чтобы
+ * освобожденные блоки переиспользовались.
+ */
+template <template <class> class Alloc, class Allocator>
+long long mixedWorkload(const Allocator& allocator, int rounds, int elements) {
+    using types = containers<Alloc>;
+    long long checksum = 0;
+
+    for (int round_index = 0; round_index < rounds; round_index++) {
+        typename types::vector_type numbers(allocator);
+        typename types::map_type index(allocator);
+        typename types::list_type queue(allocator);
+        typename types::deque_type history(allocator);
+
+        for (int element_index = 0; element_index < elements; element_index++) {
+            numbers.push_back(element_index);
+            index[element_index * 7 % elements] = element_index;
+            queue.push_back(element_index);
+            history.push_back(element_index);
+        }
+        for (int element_index = 0; element_index < elements; element_index += 2) {
+            index.erase(element_index);
+            queue.pop_front();
+            history.pop_front();
+        }
+        checksum += numbers.size() + index.size() + queue.size() + history.size();
+    }
+    return checksum;
+}
+
+template <class F>
+void measure(const char* name, F&& f) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long checksum = f();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " микросекунд (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+ * Основная функция - демонстрация аллокатора с классами размеров
+ */
+int main(int argc, char** argv) {
+    std::cout << "=== ДЕМОНСТРАЦИЯ SLAB-АЛЛОКАТОРА ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ВСЕ КОНТЕЙНЕРЫ РАБОТАЮТ
+    // ========================================================================
+    std::cout << "\n1. Использование со стандартными контейнерами:" << std::endl;
+    mai::slab_arena arena;
+    mai::slab_allocator<int> allocator(arena);
+
+    std::vector<int, mai::slab_allocator<int>> integer_vector(allocator);
+    for (int element_index = 0; element_index < 100000; element_index++) {
+        integer_vector.push_back(element_index);  // Перевыделения: 16, 32, ... байт, затем ::operator new
+    }
+    std::cout << "   vector: " << integer_vector.size() << " элементов" << std::endl;
+
+    std::map<int, int, std::less<int>, mai::slab_allocator<std::pair<const int, int>>> my_map(allocator);
+    my_map[1] = 10;
+    my_map[2] = 20;
+    my_map[3] = 30;
+    for (const auto& [key, value] : my_map)
+        std::cout << "   " << key << "->" << value << std::endl;
+
+    std::list<std::string, mai::slab_allocator<std::string>> string_list(allocator);
+    string_list.push_back("slab");
+    string_list.push_back("allocator");
+    std::cout << "   list: " << string_list.front() << " " << string_list.back() << std::endl;
+
+    auto copy = my_map;  // Копия использует ту же арену
+    std::cout << "   Аллокаторы копии и оригинала равны: " << std::boolalpha
+              << (copy.get_allocator() == my_map.get_allocator()) << std::endl;
+    std::cout << "   Слябов выделено: " << arena.slab_count() << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: СМЕШАННАЯ НАГРУЗКА
+    // ========================================================================
+    const int rounds = 200;
+    const int elements = 5000;
+    std::cout << "\n2. Смешанная нагрузка (" << rounds << " раундов по " << elements
+              << " элементов в vector/map/list/deque):" << std::endl;
+
+    measure("std::allocator", [&]() {
+        return mixedWorkload<std::allocator>(std::allocator<int>(), rounds, elements);
+    });
+
+    mai::slab_arena benchmark_arena;
+    measure("mai::slab_allocator", [&]() {
+        return mixedWorkload<mai::slab_allocator>(mai::slab_allocator<int>(benchmark_arena), rounds, elements);
+    });
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
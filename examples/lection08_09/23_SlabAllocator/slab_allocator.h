@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace mai {
+    /**
+     * Арена с классами размеров (size classes)
+     *
+     * Запросы до max_block байт округляются вверх до степени двойки
+     * (16, 32, 64, ..., 4096) и обслуживаются из "слябов" - страниц по
+     * slab_size байт, нарезанных на блоки одного размера. Освобожденный блок
+     * кладется в список свободных блоков своего класса и переиспользуется.
+     * Запросы больше max_block уходят в ::operator new.
+     *
+     * Блок размера 2^k лежит в сдвиге, кратном 2^k, от начала сляба, а слябы
+     * выровнены на slab_alignment - поэтому любое выравнивание до размера блока
+     * выполняется само собой.
+     *
+     * Обычная арена не потокобезопасна (как std::pmr::unsynchronized_pool_resource):
+     * один экземпляр используется из одного потока. Арена, созданная с
+     * synchronized, захватывает мьютекс на каждое выделение и освобождение -
+     * такова общая default_arena(), ее используют аллокаторы из любых потоков.
+     */
+    class slab_arena {
+    public:
+        static constexpr size_t min_class_shift = 4;                      // 16 байт
+        static constexpr size_t max_class_shift = 12;                     // 4096 байт
+        static constexpr size_t class_count = max_class_shift - min_class_shift + 1;
+        static constexpr size_t max_block = size_t(1) << max_class_shift;
+        static constexpr size_t slab_size = 64 * 1024;
+        static constexpr size_t slab_alignment = max_block;
+
+    private:
+        struct free_node {
+            free_node* next;
+        };
+
+        struct size_class {
+            free_node* free_list = nullptr;
+            char* cursor = nullptr;     // Еще не нарезанная часть текущего сляба
+            char* end = nullptr;
+        };
+
+        size_class classes[class_count];
+        std::vector<void*> slabs;
+        bool is_synchronized = false;
+        mutable std::mutex mtx;         // Только для is_synchronized
+
+        static size_t class_index(size_t size) {
+            if (size <= (size_t(1) << min_class_shift)) return 0;
+            return std::bit_width(size - 1) - min_class_shift;
+        }
+
+        static bool is_small(size_t bytes, size_t alignment) {
+            return bytes <= max_block && alignment <= max_block;
+        }
+
+        void* allocate_from_new_slab(size_class& cls, size_t block) {
+            char* slab = static_cast<char*>(::operator new(slab_size, std::align_val_t(slab_alignment)));
+            slabs.push_back(slab);
+            cls.cursor = slab + block;
+            cls.end = slab + slab_size;
+            return slab;
+        }
+
+        void* allocate_unlocked(size_t bytes, size_t alignment) {
+            size_t index = class_index(std::max(bytes, alignment));
+            size_class& cls = classes[index];
+
+            if (cls.free_list) {
+                free_node* node = cls.free_list;
+                cls.free_list = node->next;
+                return node;
+            }
+
+            size_t block = size_t(1) << (index + min_class_shift);
+            if (cls.cursor == cls.end) return allocate_from_new_slab(cls, block);
+
+            void* result = cls.cursor;
+            cls.cursor += block;
+            return result;
+        }
+
+        void deallocate_unlocked(void* pointer, size_t bytes, size_t alignment) noexcept {
+            size_class& cls = classes[class_index(std::max(bytes, alignment))];
+            free_node* node = static_cast<free_node*>(pointer);
+            node->next = cls.free_list;
+            cls.free_list = node;
+        }
+
+    public:
+        struct synchronized_t {
+            explicit synchronized_t() = default;
+        };
+        static constexpr synchronized_t synchronized{};
+
+        slab_arena() = default;
+        explicit slab_arena(synchronized_t) : is_synchronized(true) {}
+        slab_arena(const slab_arena&) = delete;
+        slab_arena& operator=(const slab_arena&) = delete;
+
+        ~slab_arena() {
+            for (void* slab : slabs) ::operator delete(slab, std::align_val_t(slab_alignment));
+        }
+
+        /**
+         * Выделение bytes байт с выравниванием alignment
+         * @throws std::bad_alloc если памяти нет
+         */
+        void* allocate(size_t bytes, size_t alignment) {
+            if (!is_small(bytes, alignment))
+                return ::operator new(bytes, std::align_val_t(alignment));
+            if (!is_synchronized) return allocate_unlocked(bytes, alignment);
+            std::lock_guard<std::mutex> lock(mtx);
+            return allocate_unlocked(bytes, alignment);
+        }
+
+        /**
+         * Освобождение: bytes и alignment должны совпадать с переданными в allocate
+         */
+        void deallocate(void* pointer, size_t bytes, size_t alignment) noexcept {
+            if (!is_small(bytes, alignment)) {
+                ::operator delete(pointer, std::align_val_t(alignment));
+                return;
+            }
+            if (!is_synchronized) {
+                deallocate_unlocked(pointer, bytes, alignment);
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            deallocate_unlocked(pointer, bytes, alignment);
+        }
+
+        size_t slab_count() const {
+            if (!is_synchronized) return slabs.size();
+            std::lock_guard<std::mutex> lock(mtx);
+            return slabs.size();
+        }
+
+        /**
+         * Арена по умолчанию для аллокаторов, созданных конструктором без
+         * параметров. Контейнеры в разных потоках делят ее, поэтому она
+         * синхронизирована; для скорости в одном потоке создайте свою арену
+         */
+        static slab_arena& default_arena() {
+            static slab_arena arena(synchronized);
+            return arena;
+        }
+    };
+
+    /**
+     * STL-аллокатор поверх slab_arena
+     *
+     * В отличие от mai::allocator из 19_Allocator и mai::Allocator из
+     * 20_SimpleAllocator учитывает n, поэтому работает с std::vector,
+     * std::map, std::list, std::deque и любыми другими контейнерами.
+     *
+     * Аллокатор хранит указатель на арену: два аллокатора равны, если память
+     * из одного можно освободить через другой, т.е. если у них одна арена.
+     * При копировании, перемещении и обмене контейнеров аллокатор переезжает
+     * вместе с памятью (propagate_on_container_* = true).
+     *
+     * @tparam T - тип элементов для выделения
+     */
+    template <class T>
+    class slab_allocator {
+    private:
+        slab_arena* arena;
+
+        template <class U>
+        friend class slab_allocator;
+
+    public:
+        // ========================================================================
+        // ТИПЫ ДЛЯ СОВМЕСТИМОСТИ СО STL
+        // ========================================================================
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = std::size_t;
+
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        slab_allocator() noexcept : arena(&slab_arena::default_arena()) {}
+        explicit slab_allocator(slab_arena& a) noexcept : arena(&a) {}
+
+        /**
+         * Конвертирующий конструктор: std::map<K, V> получает аллокатор для
+         * std::pair<const K, V>, а выделяет узлы дерева
+         */
+        template <class U>
+        slab_allocator(const slab_allocator<U>& other) noexcept : arena(other.arena) {}
+
+        /**
+         * Структура rebind для совместимости с STL
+         * Позволяет STL контейнерам создавать аллокаторы для других типов
+         */
+        template <class U>
+        struct rebind {
+            using other = slab_allocator<U>;
+        };
+
+        T* allocate(size_t n) {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, size_t n) noexcept {
+            arena->deallocate(pointer, n * sizeof(T), alignof(T));
+        }
+
+        slab_arena& get_arena() const noexcept { return *arena; }
+
+        template <class U>
+        bool operator==(const slab_allocator<U>& other) const noexcept {
+            return arena == other.arena;
+        }
+    };
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+namespace mai {
+    /**
+     * memory_resource со списком свободных блоков и стратегией best fit
+     *
+     * Свободные блоки хранятся в двух деревьях:
+     * - по размеру - чтобы за O(log n) найти самый маленький подходящий блок
+     * - по адресу - чтобы за O(log n) найти соседей освобождаемого блока
+     *   и слить их в один (coalescing), не допуская фрагментации
+     *
+     * Все размеры и адреса кратны granularity (16 байт). Для большего
+     * выравнивания берется блок с запасом, а лишнее спереди и сзади
+     * возвращается в список свободных. Поэтому при освобождении блок
+     * однозначно восстанавливается по (указатель, bytes).
+     *
+     * Если подходящего блока нет, у upstream запрашивается новая область
+     * (не меньше region_size). Области возвращаются upstream в деструкторе.
+     *
+     * Узлы деревьев выделяются из отдельного пула, а не из глобальной кучи.
+     * Ресурс не потокобезопасен.
+     */
+    class best_fit_resource : public std::pmr::memory_resource {
+    private:
+        static constexpr size_t granularity = 16;
+
+        struct Region {
+            void* pointer;
+            size_t size;
+        };
+
+        std::pmr::memory_resource* upstream;
+        size_t region_size;
+        std::vector<Region> regions;
+
+        std::pmr::unsynchronized_pool_resource node_pool;
+        std::pmr::set<std::pair<size_t, char*>> free_by_size;   // (размер, адрес)
+        std::pmr::map<char*, size_t> free_by_address;           // адрес -> размер
+
+        static size_t round_up(size_t value, size_t step) {
+            return (value + step - 1) / step * step;
+        }
+
+        void insert_free(char* pointer, size_t size) {
+            free_by_size.emplace(size, pointer);
+            free_by_address.emplace(pointer, size);
+        }
+
+        void erase_free(std::pmr::map<char*, size_t>::iterator it) {
+            free_by_size.erase({it->second, it->first});
+            free_by_address.erase(it);
+        }
+
+        void add_region(size_t min_bytes) {
+            size_t size = std::max(region_size, round_up(min_bytes, granularity));
+            void* pointer = upstream->allocate(size, granularity);
+            regions.push_back({pointer, size});
+            release_block(static_cast<char*>(pointer), size);
+        }
+
+        /**
+         * Возврат блока в список свободных со слиянием соседей
+         */
+        void release_block(char* pointer, size_t size) {
+            auto next = free_by_address.lower_bound(pointer);
+            if (next != free_by_address.end() && pointer + size == next->first) {
+                size += next->second;
+                auto after = std::next(next);
+                erase_free(next);
+                next = after;
+            }
+            if (next != free_by_address.begin()) {
+                auto previous = std::prev(next);
+                if (previous->first + previous->second == pointer) {
+                    pointer = previous->first;
+                    size += previous->second;
+                    erase_free(previous);
+                }
+            }
+            insert_free(pointer, size);
+        }
+
+    public:
+        /**
+         * @param region_size - минимальный размер области, запрашиваемой у upstream
+         * @param upstream - откуда брать области
+         */
+        explicit best_fit_resource(size_t region_size = 1 << 20,
+                                   std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : upstream(upstream), region_size(round_up(std::max<size_t>(region_size, granularity), granularity)),
+              node_pool(upstream), free_by_size(&node_pool), free_by_address(&node_pool) {}
+
+        best_fit_resource(const best_fit_resource&) = delete;
+        best_fit_resource& operator=(const best_fit_resource&) = delete;
+
+        ~best_fit_resource() override {
+            free_by_size.clear();
+            free_by_address.clear();
+            for (const Region& region : regions) upstream->deallocate(region.pointer, region.size, granularity);
+        }
+
+        /**
+         * Количество свободных блоков - мера фрагментации
+         */
+        size_t free_block_count() const noexcept {
+            return free_by_address.size();
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            size_t size = round_up(std::max<size_t>(bytes, 1), granularity);
+            alignment = std::max(alignment, granularity);
+            size_t search = size + (alignment - granularity);   // Запас на выравнивание
+
+            auto found = free_by_size.lower_bound({search, nullptr});
+            if (found == free_by_size.end()) {
+                add_region(search);
+                found = free_by_size.lower_bound({search, nullptr});
+            }
+
+            auto [block_size, block] = *found;
+            erase_free(free_by_address.find(block));
+
+            char* aligned = reinterpret_cast<char*>(round_up(reinterpret_cast<uintptr_t>(block), alignment));
+            size_t front = aligned - block;
+            size_t back = block_size - front - size;
+            if (front) insert_free(block, front);     // Соседи уже заняты - сливать не с чем
+            if (back) insert_free(aligned + size, back);
+            return aligned;
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t) override {
+            release_block(static_cast<char*>(pointer), round_up(std::max<size_t>(bytes, 1), granularity));
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
@@ -0,0 +1,194 @@
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+#include <list>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <exception>
+#include <cstdint>
+
+#include "monotonic_arena.h"
+#include "best_fit_resource.h"
+
+/**
+ * Ресурс из 22_ContainerWithPolymorph без отладочного вывода и с настраиваемым
+ * размером буфера. Алгоритм оставлен прежним - линейный поиск по занятым
+ * блокам и сортировка после каждого выделения, - чтобы сравнить его с новыми.
+ */
+template <size_t BUFFER_SIZE>
+class LegacyMemoryResource : public std::pmr::memory_resource {
+    struct MemoryBlock {
+        size_t offset{0};
+        size_t size{0};
+    };
+
+    std::vector<char> memory_buffer = std::vector<char>(BUFFER_SIZE);
+    std::vector<MemoryBlock> used_blocks;
+
+public:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        size_t allocation_offset = 0;
+        for (const MemoryBlock& block : used_blocks) {
+            if ((allocation_offset + bytes <= block.offset) ||
+                (allocation_offset >= block.offset + block.size)) {
+            } else {
+                allocation_offset = block.offset + block.size + 1;
+            }
+        }
+        if (allocation_offset + bytes >= BUFFER_SIZE) {
+            throw std::bad_alloc();
+        }
+        used_blocks.emplace_back(allocation_offset, bytes);
+        std::sort(used_blocks.begin(), used_blocks.end(),
+                  [](const MemoryBlock& left, const MemoryBlock& right) {
+                      return left.offset < right.offset;
+                  });
+        return memory_buffer.data() + allocation_offset;
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        for (size_t block_index = 0; block_index < used_blocks.size(); ++block_index) {
+            if (ptr == memory_buffer.data() + used_blocks[block_index].offset) {
+                used_blocks.erase(used_blocks.begin() + block_index);
+                return;
+            }
+        }
+        throw std::logic_error("Попытка освобождения не выделенного блока");
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+/**
+ * Нагрузка 1: много мелких объектов с общим временем жизни
+ * (список заполняется и уничтожается целиком)
+ */
+long long listWorkload(std::pmr::memory_resource* resource, int elements) {
+    std::pmr::list<int> numbers(resource);
+    for (int element_index = 0; element_index < elements; ++element_index) {
+        numbers.push_back(element_index);
+    }
+    return numbers.size();
+}
+
+/**
+ * Нагрузка 2: случайные выделения и освобождения разного размера
+ * и выравнивания; одновременно живет не больше live_limit блоков
+ */
+long long randomWorkload(std::pmr::memory_resource* resource, int operations, size_t live_limit) {
+    struct Allocation {
+        void* pointer;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> size_distribution(8, 512);
+    const size_t alignments[] = {8, 16, 64};
+    std::vector<Allocation> live;
+    long long misaligned = 0;
+
+    for (int operation_index = 0; operation_index < operations; ++operation_index) {
+        if (live.size() < live_limit && (live.empty() || generator() % 2)) {
+            size_t bytes = size_distribution(generator);
+            size_t alignment = alignments[generator() % 3];
+            void* pointer = resource->allocate(bytes, alignment);
+            misaligned += reinterpret_cast<uintptr_t>(pointer) % alignment != 0;
+            live.push_back({pointer, bytes, alignment});
+        } else {
+            size_t victim = generator() % live.size();
+            resource->deallocate(live[victim].pointer, live[victim].bytes, live[victim].alignment);
+            live[victim] = live.back();
+            live.pop_back();
+        }
+    }
+    for (const Allocation& allocation : live) {
+        resource->deallocate(allocation.pointer, allocation.bytes, allocation.alignment);
+    }
+    return misaligned;
+}
+
+template <class F>
+void measure(const char* name, F&& f) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long result = f();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " микросекунд (результат " << result << ")" << std::endl;
+}
+
+/**
+ * Основная функция - сравнение memory_resource
+ */
+int main() {
+    std::cout << "=== СРАВНЕНИЕ MEMORY_RESOURCE ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: МОНОТОННАЯ АРЕНА С ОБЩИМ СБРОСОМ
+    // ========================================================================
+    std::cout << "\n1. Монотонная арена:" << std::endl;
+    mai::monotonic_arena arena;
+    for (int request_index = 0; request_index < 3; ++request_index) {
+        std::pmr::vector<int> request_data(&arena);
+        for (int element_index = 0; element_index < 1000; ++element_index) request_data.push_back(element_index);
+        arena.release();  // Все временные данные запроса освобождаются разом
+    }
+    std::cout << "   Три запроса обработаны, память возвращена через release()" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: СПИСОК - МНОГО МЕЛКИХ ОБЪЕКТОВ
+    // ========================================================================
+    const int list_elements = 1000000;
+    const int legacy_list_elements = 5000;
+    std::cout << "\n2. std::pmr::list<int>, " << list_elements << " элементов:" << std::endl;
+    {
+        LegacyMemoryResource<1 << 20> legacy;
+        measure("CustomMemoryResource (только 5000 элементов)", [&]() { return listWorkload(&legacy, legacy_list_elements); });
+    }
+    measure("new_delete_resource", [&]() { return listWorkload(std::pmr::new_delete_resource(), list_elements); });
+    {
+        std::pmr::unsynchronized_pool_resource pool;
+        measure("unsynchronized_pool_resource", [&]() { return listWorkload(&pool, list_elements); });
+    }
+    {
+        mai::monotonic_arena monotonic;
+        measure("mai::monotonic_arena", [&]() { return listWorkload(&monotonic, list_elements); });
+    }
+    {
+        mai::best_fit_resource best_fit;
+        measure("mai::best_fit_resource", [&]() { return listWorkload(&best_fit, list_elements); });
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: СЛУЧАЙНЫЕ РАЗМЕРЫ И ВЫРАВНИВАНИЯ
+    // ========================================================================
+    const int operations = 1000000;
+    const int legacy_operations = 20000;
+    const size_t live_limit = 1000;
+    std::cout << "\n3. Случайные выделения 8..512 байт, выравнивание 8/16/64, " << operations
+              << " операций (результат - число невыровненных блоков):" << std::endl;
+    {
+        LegacyMemoryResource<1 << 20> legacy;
+        measure("CustomMemoryResource (только 20000 операций)", [&]() { return randomWorkload(&legacy, legacy_operations, live_limit); });
+    }
+    measure("new_delete_resource", [&]() { return randomWorkload(std::pmr::new_delete_resource(), operations, live_limit); });
+    {
+        std::pmr::unsynchronized_pool_resource pool;
+        measure("unsynchronized_pool_resource", [&]() { return randomWorkload(&pool, operations, live_limit); });
+    }
+    {
+        mai::monotonic_arena monotonic;
+        measure("mai::monotonic_arena", [&]() { return randomWorkload(&monotonic, operations, live_limit); });
+    }
+    {
+        mai::best_fit_resource best_fit;
+        measure("mai::best_fit_resource", [&]() { return randomWorkload(&best_fit, operations, live_limit); });
+        std::cout << "   Свободных блоков best_fit после освобождения всего: " << best_fit.free_block_count() << std::endl;
+    }
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
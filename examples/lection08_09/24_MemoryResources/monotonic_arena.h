@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace mai {
+    /**
+     * Монотонная арена (bump-pointer allocator)
+     *
+     * Выделение - это сдвиг указателя внутри текущего блока с учетом
+     * выравнивания. Освобождение отдельных объектов ничего не делает;
+     * вся память освобождается разом через release() или в деструкторе.
+     * Когда текущий блок заканчивается, у upstream запрашивается новый,
+     * в growth_factor раз больше предыдущего.
+     *
+     * Подходит для объектов с общим временем жизни: обработка одного
+     * запроса, один кадр, временные структуры одного алгоритма.
+     */
+    class monotonic_arena : public std::pmr::memory_resource {
+    private:
+        /**
+         * Заголовок блока, полученного у upstream. Блоки связаны в список,
+         * чтобы release() мог вернуть их все.
+         */
+        struct BlockHeader {
+            BlockHeader* previous;
+            size_t size;       // Полный размер блока вместе с заголовком
+        };
+
+        static constexpr size_t growth_factor = 2;
+
+        std::pmr::memory_resource* upstream;
+        BlockHeader* current_block = nullptr;
+        char* cursor = nullptr;        // Первый свободный байт текущего блока
+        char* block_end = nullptr;
+        size_t initial_size;
+        size_t next_block_size;
+
+        void add_block(size_t min_bytes, size_t alignment) {
+            size_t needed = sizeof(BlockHeader) + min_bytes + alignment;
+            size_t size = std::max(next_block_size, needed);
+            auto* block = static_cast<BlockHeader*>(upstream->allocate(size, alignof(std::max_align_t)));
+            block->previous = current_block;
+            block->size = size;
+            current_block = block;
+            cursor = reinterpret_cast<char*>(block + 1);
+            block_end = reinterpret_cast<char*>(block) + size;
+            next_block_size = size * growth_factor;
+        }
+
+    public:
+        /**
+         * @param initial_size - размер первого блока в байтах
+         * @param upstream - откуда брать блоки
+         */
+        explicit monotonic_arena(size_t initial_size = 4096,
+                                 std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : upstream(upstream), initial_size(std::max<size_t>(initial_size, 64)),
+              next_block_size(this->initial_size) {}
+
+        monotonic_arena(const monotonic_arena&) = delete;
+        monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+        ~monotonic_arena() override {
+            release();
+        }
+
+        /**
+         * Освобождение всей выделенной памяти разом
+         * Все указатели, полученные из арены, становятся недействительными
+         */
+        void release() noexcept {
+            while (current_block) {
+                BlockHeader* previous = current_block->previous;
+                upstream->deallocate(current_block, current_block->size, alignof(std::max_align_t));
+                current_block = previous;
+            }
+            cursor = block_end = nullptr;
+            next_block_size = initial_size;
+        }
+
+        std::pmr::memory_resource* upstream_resource() const noexcept {
+            return upstream;
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* pointer = cursor;
+            size_t space = block_end - cursor;
+            if (!cursor || !std::align(alignment, bytes, pointer, space)) {
+                add_block(bytes, alignment);
+                pointer = cursor;
+                space = block_end - cursor;
+                std::align(alignment, bytes, pointer, space);
+            }
+            cursor = static_cast<char*>(pointer) + bytes;
+            return pointer;
+        }
+
+        void do_deallocate(void*, size_t, size_t) override {
+            // Память возвращается только через release()
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mai {
+    /**
+     * Снимок статистики одного tracking_resource
+     */
+    struct allocation_snapshot {
+        static constexpr size_t bucket_count = 33;   // Размеры 0, 1, 2, 3-4, 5-8, ..., 2^31+
+
+        std::string tag;
+        uint64_t allocations = 0;
+        uint64_t deallocations = 0;
+        uint64_t allocated_bytes = 0;
+        uint64_t deallocated_bytes = 0;
+        int64_t live_bytes = 0;
+        int64_t peak_bytes = 0;
+        std::array<uint64_t, bucket_count> histogram{};
+
+        /**
+         * Нижняя граница корзины гистограммы в байтах
+         */
+        static uint64_t bucket_lower_bound(size_t bucket) {
+            return bucket <= 1 ? bucket : (uint64_t(1) << (bucket - 2)) + 1;
+        }
+
+        std::string to_text() const {
+            std::ostringstream out;
+            out << "[" << tag << "] allocations: " << allocations
+                << ", deallocations: " << deallocations
+                << ", allocated: " << allocated_bytes << " B"
+                << ", live: " << live_bytes << " B"
+                << ", peak: " << peak_bytes << " B\n";
+            for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+                if (!histogram[bucket]) continue;
+                uint64_t upper = bucket == 0 ? 0 : uint64_t(1) << (bucket - 1);
+                out << "    " << bucket_lower_bound(bucket) << ".." << upper << " B: " << histogram[bucket] << "\n";
+            }
+            return out.str();
+        }
+
+        std::string to_json() const {
+            std::ostringstream out;
+            out << "{\"tag\":\"";
+            for (char c : tag) {
+                if (c == '"' || c == '\\') out << '\\';
+                out << c;
+            }
+            out << "\",\"allocations\":" << allocations
+                << ",\"deallocations\":" << deallocations
+                << ",\"allocated_bytes\":" << allocated_bytes
+                << ",\"deallocated_bytes\":" << deallocated_bytes
+                << ",\"live_bytes\":" << live_bytes
+                << ",\"peak_bytes\":" << peak_bytes
+                << ",\"histogram\":[";
+            bool first = true;
+            for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+                if (!histogram[bucket]) continue;
+                if (!first) out << ",";
+                first = false;
+                uint64_t upper = bucket == 0 ? 0 : uint64_t(1) << (bucket - 1);
+                out << "{\"from\":" << bucket_lower_bound(bucket) << ",\"to\":" << upper
+                    << ",\"count\":" << histogram[bucket] << "}";
+            }
+            out << "]}";
+            return out.str();
+        }
+    };
+
+    /**
+     * memory_resource-адаптер, который считает выделения
+     *
+     * Оборачивает любой upstream и для своего тега (обычно - место в коде
+     * или контейнер: "parser", "cache", "request") считает количество
+     * выделений и освобождений, байты, текущий и пиковый объем и гистограмму
+     * размеров.
+     *
+     * У каждого потока свой набор счетчиков (шард) в отдельной кэш-линии.
+     * Владелец шарда обновляет его обычными load/store без lock-префикса,
+     * поэтому подсчет почти бесплатен и потоки не мешают друг другу.
+     * Потоки сверх max_threads делят один общий шард и используют fetch_add.
+     *
+     * Пик считается по общему живому объему всех потоков. Шард копит
+     * изменение живого объема и переносит его в общий счетчик, когда оно
+     * достигает 1/64 общего живого объема (но не меньше 256 байт); тогда же
+     * общий пик обновляется через CAS. Атомарные операции с lock-префиксом
+     * редки: пока объем растет до N байт, их около 64 * ln(N / 256). Пик
+     * может оказаться меньше настоящего не более чем на 1/64 + 256 байт на
+     * каждый поток. Живой объем в снимке точный.
+     *
+     * Все созданные ресурсы регистрируются, snapshot_all() собирает
+     * статистику по всем тегам сразу.
+     */
+    class tracking_resource : public std::pmr::memory_resource {
+    private:
+        static constexpr size_t max_threads = 64;
+        static constexpr size_t bucket_count = allocation_snapshot::bucket_count;
+        static constexpr int64_t publish_min_bytes = 256;   // Порог переноса живого объема в общий счетчик:
+        static constexpr int64_t publish_fraction = 64;     // не меньше 256 байт и 1/64 общего живого объема
+
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> deallocations{0};
+            std::atomic<uint64_t> allocated_bytes{0};
+            std::atomic<uint64_t> deallocated_bytes{0};
+            std::array<std::atomic<uint64_t>, bucket_count> histogram{};   // Сумма - число выделений
+            std::atomic<int64_t> unpublished_bytes{0};   // Изменение живого объема, еще не перенесенное в общий
+        };
+
+        std::pmr::memory_resource* upstream;
+        std::string tag;
+        std::array<Shard, max_threads + 1> shards;   // Последний - общий для "лишних" потоков
+        alignas(64) std::atomic<int64_t> published_live_bytes{0};
+        std::atomic<int64_t> peak_bytes{0};
+
+        /**
+         * Номер шарда текущего потока. Номера освобождаются при завершении
+         * потока и достаются новым потокам.
+         */
+        class ThreadSlot {
+        private:
+            static std::mutex& slots_mutex() {
+                static std::mutex mtx;
+                return mtx;
+            }
+            static std::vector<size_t>& free_slots() {
+                static std::vector<size_t> slots;
+                return slots;
+            }
+            static inline size_t next_slot = 0;
+
+        public:
+            size_t index;
+
+            ThreadSlot() {
+                std::lock_guard<std::mutex> lock(slots_mutex());
+                if (!free_slots().empty()) {
+                    index = free_slots().back();
+                    free_slots().pop_back();
+                } else {
+                    index = next_slot < max_threads ? next_slot++ : max_threads;
+                }
+            }
+
+            ~ThreadSlot() {
+                if (index == max_threads) return;
+                std::lock_guard<std::mutex> lock(slots_mutex());
+                free_slots().push_back(index);
+            }
+        };
+
+        /**
+         * Быстрый путь читает простую thread_local-переменную без проверки
+         * инициализации; ThreadSlot с деструктором создается один раз
+         */
+        static size_t thread_slot() {
+            thread_local size_t index = max_threads + 1;
+            if (index > max_threads) {
+                thread_local ThreadSlot slot;
+                index = slot.index;
+            }
+            return index;
+        }
+
+        static void add(std::atomic<uint64_t>& counter, uint64_t value, bool owned) {
+            if (owned)
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            else
+                counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        /**
+         * Учет изменения живого объема шарда (delta < 0 при освобождении).
+         * Накопленное изменение переносится в общий счетчик пачками, поэтому
+         * поток-производитель и поток-потребитель в сумме дают настоящий
+         * живой объем, хотя шард потребителя уходит в минус
+         */
+        void track_live(Shard& shard, int64_t delta, bool owned) {
+            int64_t threshold = std::max(publish_min_bytes,
+                                         published_live_bytes.load(std::memory_order_relaxed) / publish_fraction);
+            int64_t pending;
+            if (owned) {
+                pending = shard.unpublished_bytes.load(std::memory_order_relaxed) + delta;
+                if (pending < threshold && pending > -threshold) {
+                    shard.unpublished_bytes.store(pending, std::memory_order_relaxed);
+                    return;
+                }
+                shard.unpublished_bytes.store(0, std::memory_order_relaxed);
+            } else {
+                pending = shard.unpublished_bytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+                if (pending < threshold && pending > -threshold) return;
+                pending = shard.unpublished_bytes.exchange(0, std::memory_order_relaxed);
+            }
+
+            int64_t live = published_live_bytes.fetch_add(pending, std::memory_order_relaxed) + pending;
+            int64_t peak = peak_bytes.load(std::memory_order_relaxed);
+            while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+                ;
+        }
+
+        static size_t bucket_of(size_t bytes) {
+            return bytes == 0 ? 0 : std::min<size_t>(std::bit_width(bytes - 1) + 1, bucket_count - 1);
+        }
+
+        struct Registry {
+            std::mutex mtx;
+            std::vector<tracking_resource*> resources;
+        };
+
+        static Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+    public:
+        explicit tracking_resource(std::string tag,
+                                   std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : upstream(upstream), tag(std::move(tag)) {
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            all.resources.push_back(this);
+        }
+
+        tracking_resource(const tracking_resource&) = delete;
+        tracking_resource& operator=(const tracking_resource&) = delete;
+
+        ~tracking_resource() override {
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            all.resources.erase(std::find(all.resources.begin(), all.resources.end(), this));
+        }
+
+        allocation_snapshot snapshot() const {
+            allocation_snapshot result;
+            result.tag = tag;
+            for (const Shard& shard : shards) {
+                result.deallocations += shard.deallocations.load(std::memory_order_relaxed);
+                result.allocated_bytes += shard.allocated_bytes.load(std::memory_order_relaxed);
+                result.deallocated_bytes += shard.deallocated_bytes.load(std::memory_order_relaxed);
+                for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+                    result.histogram[bucket] += shard.histogram[bucket].load(std::memory_order_relaxed);
+            }
+            for (uint64_t count : result.histogram) result.allocations += count;
+            result.live_bytes = int64_t(result.allocated_bytes - result.deallocated_bytes);
+            result.peak_bytes = std::max(peak_bytes.load(std::memory_order_relaxed), result.live_bytes);
+            return result;
+        }
+
+        /**
+         * Статистика всех существующих tracking_resource, по убыванию
+         * количества выделенных байт - сверху "горячие" места
+         */
+        static std::vector<allocation_snapshot> snapshot_all() {
+            std::vector<allocation_snapshot> result;
+            {
+                Registry& all = registry();
+                std::lock_guard<std::mutex> lock(all.mtx);
+                for (const tracking_resource* resource : all.resources) result.push_back(resource->snapshot());
+            }
+            std::sort(result.begin(), result.end(), [](const auto& left, const auto& right) {
+                return left.allocated_bytes > right.allocated_bytes;
+            });
+            return result;
+        }
+
+        static std::string report_json() {
+            std::string out = "[";
+            for (const allocation_snapshot& snapshot : snapshot_all()) {
+                if (out.size() > 1) out += ",";
+                out += snapshot.to_json();
+            }
+            return out + "]";
+        }
+
+        static std::string report_text() {
+            std::string out;
+            for (const allocation_snapshot& snapshot : snapshot_all()) out += snapshot.to_text();
+            return out;
+        }
+
+        std::pmr::memory_resource* upstream_resource() const noexcept {
+            return upstream;
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* pointer = upstream->allocate(bytes, alignment);
+
+            size_t slot = thread_slot();
+            bool owned = slot < max_threads;
+            Shard& shard = shards[slot];
+            add(shard.allocated_bytes, bytes, owned);
+            add(shard.histogram[bucket_of(bytes)], 1, owned);
+            track_live(shard, int64_t(bytes), owned);
+            return pointer;
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+            size_t slot = thread_slot();
+            bool owned = slot < max_threads;
+            Shard& shard = shards[slot];
+            add(shard.deallocations, 1, owned);
+            add(shard.deallocated_bytes, bytes, owned);
+            track_live(shard, -int64_t(bytes), owned);
+
+            upstream->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
@@ -0,0 +1,165 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <random>
+#include <algorithm>
+
+#include "pooled.h"
+
+/**
+ * Базовый класс иерархии - виртуальный деструктор обязателен:
+ * через него operator delete узнает настоящий размер объекта
+ */
+class Shape {
+public:
+    virtual ~Shape() = default;
+    virtual double area() const = 0;
+};
+
+/**
+ * Обычный класс - память из глобальной кучи
+ */
+class Circle : public Shape {
+private:
+    double radius;
+
+public:
+    explicit Circle(double radius) : radius(radius) {}
+    double area() const override { return 3.14159 * radius * radius; }
+};
+
+/**
+ * Тот же класс с пулом - достаточно унаследовать mai::pooled<...>
+ */
+class PooledCircle : public Shape, public mai::pooled<PooledCircle> {
+private:
+    double radius;
+
+public:
+    explicit PooledCircle(double radius) : radius(radius) {}
+    double area() const override { return 3.14159 * radius * radius; }
+};
+
+/**
+ * Наследник другого размера - не помещается в блок пула,
+ * operator new/delete переходят на глобальную кучу
+ */
+class ColoredCircle : public PooledCircle {
+private:
+    int color[4];
+
+public:
+    ColoredCircle(double radius, int red) : PooledCircle(radius), color{red, 0, 0, 255} {}
+};
+
+/**
+ * Указатель "убегает" сюда, чтобы компилятор не выбросил пару new/delete
+ */
+Shape* volatile escaped_shape = nullptr;
+
+/**
+ * Сценарий 1: объект создается и сразу уничтожается
+ */
+template <class T>
+double createDestroy(int count) {
+    double total_area = 0;
+    for (int object_index = 0; object_index < count; ++object_index) {
+        Shape* shape = new T(object_index % 10);
+        escaped_shape = shape;
+        total_area += shape->area();
+        delete shape;
+    }
+    return total_area;
+}
+
+/**
+ * Сценарий 2: много живых объектов, удаление в случайном порядке
+ */
+template <class T>
+double manyAlive(int count) {
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.reserve(count);
+    for (int object_index = 0; object_index < count; ++object_index) {
+        shapes.emplace_back(new T(object_index % 10));
+    }
+    std::shuffle(shapes.begin(), shapes.end(), std::mt19937(42));
+    double total_area = 0;
+    for (auto& shape : shapes) {
+        total_area += shape->area();
+        shape.reset();
+    }
+    return total_area;
+}
+
+/**
+ * Замер второго запуска: первый прогревает память
+ * (страницы пула и кучи уже получены у системы)
+ */
+template <class F>
+void measure(const char* name, F&& f) {
+    f();
+    auto start_time = std::chrono::high_resolution_clock::now();
+    double result = f();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " микросекунд (площадь " << result << ")" << std::endl;
+}
+
+/**
+ * Основная функция - демонстрация пула для operator new/delete
+ */
+int main() {
+    std::cout << "=== ПУЛ ДЛЯ OPERATOR NEW/DELETE ЧЕРЕЗ CRTP ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ПЕРЕИСПОЛЬЗОВАНИЕ БЛОКОВ
+    // ========================================================================
+    std::cout << "\n1. Переиспользование блоков:" << std::endl;
+    Shape* first = new PooledCircle(1);
+    void* first_address = first;
+    delete first;
+    Shape* second = new PooledCircle(2);
+    std::cout << "   Второй объект занял блок первого: " << std::boolalpha << (first_address == second) << std::endl;
+    delete second;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: НАСЛЕДНИК ДРУГОГО РАЗМЕРА
+    // ========================================================================
+    std::cout << "\n2. Наследник другого размера:" << std::endl;
+    std::cout << "   sizeof(PooledCircle) = " << sizeof(PooledCircle)
+              << ", sizeof(ColoredCircle) = " << sizeof(ColoredCircle) << std::endl;
+    Shape* colored = new ColoredCircle(3, 255);  // Глобальный ::operator new
+    std::cout << "   Площадь: " << colored->area() << std::endl;
+    delete colored;                              // Глобальный ::operator delete
+    std::cout << "   Создан и удален через глобальную кучу" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ПРОИЗВОДИТЕЛЬНОСТЬ
+    // ========================================================================
+    const int count = 5000000;
+    std::cout << "\n3. Создание и немедленное удаление, " << count << " объектов:" << std::endl;
+    measure("Глобальная куча", [&]() { return createDestroy<Circle>(count); });
+    measure("mai::pooled", [&]() { return createDestroy<PooledCircle>(count); });
+
+    const int alive = 1000000;
+    std::cout << "\n4. " << alive << " живых объектов, удаление в случайном порядке:" << std::endl;
+    measure("Глобальная куча", [&]() { return manyAlive<Circle>(alive); });
+    measure("mai::pooled", [&]() { return manyAlive<PooledCircle>(alive); });
+
+    std::cout << "\n5. Те же объекты в 4 потоках:" << std::endl;
+    auto parallel = [&](auto run) {
+        std::vector<std::thread> threads;
+        for (int thread_index = 0; thread_index < 4; ++thread_index)
+            threads.emplace_back([&]() { run(alive / 4); });
+        for (auto& thread : threads) thread.join();
+        return 0.0;
+    };
+    measure("Глобальная куча", [&]() { return parallel(manyAlive<Circle>); });
+    measure("mai::pooled", [&]() { return parallel(manyAlive<PooledCircle>); });
+    std::cout << "   Страниц в пуле PooledCircle: " << mai::pooled<PooledCircle>::page_count() << std::endl;
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace mai {
+    /**
+     * CRTP-примесь, которая дает классу собственные operator new/delete
+     * на пуле блоков фиксированного размера
+     *
+     * В отличие от CustomAllocatorDemo из 18_OperatorNew память не
+     * заканчивается и переиспользуется:
+     * - освобожденный блок кладется в список свободных блоков текущего потока
+     *   (thread_local), следующий new берет его оттуда без блокировок
+     * - когда список пуст, поток нарезает новую страницу на блоки
+     * - при завершении потока его свободные блоки уходят в общий список,
+     *   из которого их заберут другие потоки
+     *
+     * Наследник Derived другого размера (например, добавивший поля) не
+     * помещается в блок - для него operator new/delete обращаются к
+     * глобальным ::operator new/delete. Размер приходит в operator delete
+     * из виртуального деструктора, поэтому базовый класс иерархии должен
+     * иметь виртуальный деструктор.
+     *
+     * Страницы не возвращаются системе: блоки могут быть живы в других
+     * потоках в любой момент, поэтому пул только растет до максимума.
+     *
+     * @tparam Derived - класс, которому нужен пул
+     * @tparam PAGE_SIZE - размер страницы в байтах
+     */
+    template <class Derived, size_t PAGE_SIZE = 64 * 1024>
+    class pooled {
+    private:
+        struct Node {
+            Node* next;
+        };
+
+        /**
+         * Общая часть пула: свободные блоки завершившихся потоков и
+         * список всех страниц
+         */
+        struct Shared {
+            std::mutex mtx;
+            Node* orphans = nullptr;
+            std::vector<void*> pages;
+        };
+
+        /**
+         * Свободные блоки одного потока
+         */
+        struct Local {
+            Node* free_list = nullptr;
+            char* cursor = nullptr;     // Еще не нарезанная часть последней страницы
+            char* page_end = nullptr;
+
+            ~Local() {
+                if (!free_list) return;
+                Node* last = free_list;
+                while (last->next) last = last->next;
+                Shared& shared = shared_state();
+                std::lock_guard<std::mutex> lock(shared.mtx);
+                last->next = shared.orphans;
+                shared.orphans = free_list;
+            }
+        };
+
+        static Shared& shared_state() {
+            static Shared* shared = new Shared;   // Не разрушается: блоки могут освобождаться до самого конца
+            return *shared;
+        }
+
+        static Local& local_state() {
+            thread_local Local local;
+            return local;
+        }
+
+        static constexpr size_t block_alignment() {
+            return std::max(alignof(Derived), alignof(Node));
+        }
+
+        static constexpr size_t block_size() {
+            return (std::max(sizeof(Derived), sizeof(Node)) + block_alignment() - 1) / block_alignment() * block_alignment();
+        }
+
+        /**
+         * Медленный путь: забрать блоки завершившихся потоков или новую страницу
+         */
+        static void* refill(Local& local) {
+            static_assert(PAGE_SIZE >= block_size(), "Страница должна вмещать хотя бы один блок");
+            Shared& shared = shared_state();
+            std::lock_guard<std::mutex> lock(shared.mtx);
+            if (shared.orphans) {
+                Node* node = shared.orphans;
+                local.free_list = node->next;
+                shared.orphans = nullptr;
+                return node;
+            }
+            char* page = static_cast<char*>(::operator new(PAGE_SIZE, std::align_val_t(block_alignment())));
+            shared.pages.push_back(page);
+            local.cursor = page + block_size();
+            local.page_end = page + PAGE_SIZE / block_size() * block_size();
+            return page;
+        }
+
+    public:
+        static void* operator new(size_t size) {
+            if (size != sizeof(Derived)) return ::operator new(size);
+
+            Local& local = local_state();
+            if (Node* node = local.free_list) {
+                local.free_list = node->next;
+                return node;
+            }
+            if (local.cursor != local.page_end) {
+                void* block = local.cursor;
+                local.cursor += block_size();
+                return block;
+            }
+            return refill(local);
+        }
+
+        static void operator delete(void* pointer, size_t size) noexcept {
+            if (!pointer) return;
+            if (size != sizeof(Derived)) {
+                ::operator delete(pointer);
+                return;
+            }
+            Local& local = local_state();
+            Node* node = static_cast<Node*>(pointer);
+            node->next = local.free_list;
+            local.free_list = node;
+        }
+
+        /**
+         * Количество страниц, полученных пулом у системы
+         */
+        static size_t page_count() {
+            Shared& shared = shared_state();
+            std::lock_guard<std::mutex> lock(shared.mtx);
+            return shared.pages.size();
+        }
+    };
+}
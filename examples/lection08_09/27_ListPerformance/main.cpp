@@ -0,0 +1,200 @@
+#include <iostream>
+#include <chrono>
+#include <list>
+#include <forward_list>
+#include <memory>
+#include <cstdlib>
+
+#include "../03_UniqueIterator/list.h"
+
+/**
+ * Прежняя реализация List из 03_UniqueIterator (только то, что нужно для замера)
+ * push_back и доступ по индексу спускаются по цепочке unique_ptr рекурсивно,
+ * итератор хранит индекс - поэтому обход стоит O(n²)
+ */
+template <class T>
+class LegacyList{
+    private:
+        struct ListItem{
+            std::unique_ptr<ListItem> next;
+            T value;
+            void push_back(const T& new_value){
+                if(next) next->push_back(new_value);
+                else next = std::make_unique<ListItem>(ListItem{std::unique_ptr<ListItem>(), new_value});
+            }
+            T& get(size_t index){
+                if(index == 0) return value;
+                return next->get(--index);
+            }
+            size_t size(){
+                if(next) return next->size() + 1;
+                return 1;
+            }
+        };
+        std::unique_ptr<ListItem> head;
+    public:
+        void push_back(const T& value){
+            if(head) head->push_back(value);
+            else head = std::make_unique<ListItem>(ListItem{std::unique_ptr<ListItem>(), value});
+        }
+        size_t size(){
+            return head ? head->size() : 0;
+        }
+        T& operator[](size_t index){
+            return head->get(index);
+        }
+};
+
+/**
+ * Измерение времени выполнения функции
+ *
+ * @param name - название варианта для вывода
+ * @param function - измеряемое действие, возвращает контрольное значение
+ */
+template <typename Function>
+void measure(const char* name, Function function){
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long checksum = function();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " мс (контрольная сумма " << checksum << ")" << std::endl;
+}
+
+/**
+ * Заполнение, обход и вставка в середину для контейнера с push_back
+ *
+ * @param name - название контейнера
+ * @param count - количество элементов
+ */
+template <typename Container>
+void benchmarkContainer(const char* name, size_t count){
+    std::cout << "\n" << name << ":" << std::endl;
+    Container container;
+
+    measure("push_back", [&]{
+        for(size_t element_index = 0; element_index < count; ++element_index)
+            container.push_back(static_cast<int>(element_index));
+        return static_cast<long long>(count);
+    });
+
+    measure("обход", [&]{
+        long long sum = 0;
+        for(auto iterator = container.begin(); iterator != container.end(); ++iterator)
+            sum += *iterator;
+        return sum;
+    });
+
+    // Вставка между каждой парой соседних элементов - итератор уже стоит
+    // на месте, поэтому каждая вставка O(1)
+    measure("вставка между соседними элементами", [&]{
+        long long inserted = 0;
+        auto iterator = container.begin();
+        while(iterator != container.end()){
+            ++iterator;
+            if(iterator == container.end()) break;
+            iterator = container.insert(iterator, -1);
+            ++iterator;
+            ++inserted;
+        }
+        return inserted;
+    });
+
+    measure("разрушение", [&]{
+        Container removed = std::move(container);
+        return 0LL;
+    });
+}
+
+/**
+ * std::forward_list вставляет после итератора, поэтому замер отдельный
+ */
+void benchmarkForwardList(size_t count){
+    std::cout << "\nstd::forward_list:" << std::endl;
+    std::forward_list<int> container;
+
+    measure("заполнение (insert_after в конец)", [&]{
+        auto last = container.before_begin();
+        for(size_t element_index = 0; element_index < count; ++element_index)
+            last = container.insert_after(last, static_cast<int>(element_index));
+        return static_cast<long long>(count);
+    });
+
+    measure("обход", [&]{
+        long long sum = 0;
+        for(int value : container) sum += value;
+        return sum;
+    });
+
+    measure("вставка между соседними элементами", [&]{
+        long long inserted = 0;
+        auto iterator = container.begin();
+        while(std::next(iterator) != container.end()){
+            iterator = container.insert_after(iterator, -1);
+            ++iterator;
+            ++inserted;
+        }
+        return inserted;
+    });
+
+    measure("разрушение", [&]{
+        std::forward_list<int> removed = std::move(container);
+        return 0LL;
+    });
+}
+
+/**
+ * Основная функция - сравнение производительности списков
+ *
+ * Аргументы: [количество элементов] (по умолчанию 10 000 000)
+ */
+int main(int argc, char** argv){
+    size_t element_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    // Старая версия квадратичная и рекурсивная: больше нескольких тысяч элементов не выдержит
+    const size_t legacy_count = 5'000;
+
+    std::cout << "=== ПРОИЗВОДИТЕЛЬНОСТЬ СПИСКОВ ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: СТАРЫЙ И НОВЫЙ LIST НА МАЛОМ ОБЪЕМЕ
+    // ========================================================================
+    std::cout << "\n1. " << legacy_count << " элементов, прежний List (рекурсия, индексный итератор):" << std::endl;
+    {
+        LegacyList<int> legacy_list;
+        measure("push_back", [&]{
+            for(size_t element_index = 0; element_index < legacy_count; ++element_index)
+                legacy_list.push_back(static_cast<int>(element_index));
+            return static_cast<long long>(legacy_list.size());
+        });
+        measure("обход по индексам", [&]{
+            long long sum = 0;
+            for(size_t element_index = 0; element_index < legacy_count; ++element_index)
+                sum += legacy_list[element_index];
+            return sum;
+        });
+    }
+    std::cout << "   Новый List на тех же " << legacy_count << " элементах:" << std::endl;
+    {
+        List<int> new_list;
+        measure("push_back", [&]{
+            for(size_t element_index = 0; element_index < legacy_count; ++element_index)
+                new_list.push_back(static_cast<int>(element_index));
+            return static_cast<long long>(new_list.size());
+        });
+        measure("обход итератором", [&]{
+            long long sum = 0;
+            for(int value : new_list) sum += value;
+            return sum;
+        });
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: 10 МЛН ЭЛЕМЕНТОВ
+    // ========================================================================
+    std::cout << "\n2. " << element_count << " элементов:" << std::endl;
+    benchmarkContainer<List<int>>("List (пул узлов)", element_count);
+    benchmarkContainer<std::list<int>>("std::list", element_count);
+    benchmarkForwardList(element_count);
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
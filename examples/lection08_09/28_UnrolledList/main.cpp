@@ -0,0 +1,165 @@
+#include <iostream>
+#include <chrono>
+#include <list>
+#include <forward_list>
+#include <vector>
+#include <cstdlib>
+#include <new>
+
+#include "unrolled_list.h"
+
+/**
+ * Счетчик памяти, занятой в куче: глобальные operator new/delete
+ * хранят размер блока перед ним, чтобы учесть и delete без размера.
+ * Считаются запрошенные байты, служебные заголовки malloc не входят
+ */
+static size_t live_heap_bytes = 0;
+static size_t heap_allocations = 0;
+
+void* operator new(size_t size) {
+    void* block = std::malloc(size + alignof(std::max_align_t));
+    if (!block) throw std::bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    live_heap_bytes += size;
+    ++heap_allocations;
+    return static_cast<char*>(block) + alignof(std::max_align_t);
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    void* block = static_cast<char*>(pointer) - alignof(std::max_align_t);
+    live_heap_bytes -= *static_cast<size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+/**
+ * Измерение времени выполнения функции
+ *
+ * @param name - название замера
+ * @param function - измеряемое действие, возвращает контрольное значение
+ */
+template <typename Function>
+void measure(const char* name, Function function) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long checksum = function();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " мс (контрольная сумма " << checksum << ")" << std::endl;
+}
+
+/**
+ * Заполнение с конца - у std::forward_list нет push_back
+ */
+template <typename Container>
+void fill(Container& container, size_t count) {
+    if constexpr (std::is_same_v<Container, std::forward_list<int>>) {
+        auto last = container.before_begin();
+        for (size_t element_index = 0; element_index < count; ++element_index)
+            last = container.insert_after(last, static_cast<int>(element_index));
+    } else {
+        for (size_t element_index = 0; element_index < count; ++element_index)
+            container.push_back(static_cast<int>(element_index));
+    }
+}
+
+/**
+ * Вставка count элементов в середину контейнера
+ * Итератор на место вставки находится один раз, дальше вставка идет перед ним
+ */
+template <typename Container>
+long long insertInMiddle(Container& container, size_t size, size_t count) {
+    auto where = container.begin();
+    std::advance(where, size / 2);
+    for (size_t element_index = 0; element_index < count; ++element_index) {
+        if constexpr (std::is_same_v<Container, std::forward_list<int>>)
+            container.insert_after(where, -1);       // вставка после where
+        else
+            where = container.insert(where, -1);     // у std::vector - O(n) сдвиг хвоста
+    }
+    return static_cast<long long>(count);
+}
+
+/**
+ * Полный набор замеров для одного контейнера
+ *
+ * @param name - название контейнера
+ * @param element_count - размер для заполнения и обхода
+ * @param middle_base - размер контейнера для вставки в середину
+ * @param middle_inserts - количество вставок в середину
+ */
+template <typename Container>
+void benchmarkContainer(const char* name, size_t element_count, size_t middle_base, size_t middle_inserts) {
+    std::cout << "\n" << name << ":" << std::endl;
+    {
+        size_t bytes_before = live_heap_bytes;
+        size_t allocations_before = heap_allocations;
+        Container container;
+        measure("заполнение", [&] { fill(container, element_count); return static_cast<long long>(element_count); });
+
+        double bytes_per_element = double(live_heap_bytes - bytes_before) / element_count;
+        std::cout << "   память: " << bytes_per_element << " байт на элемент (int - " << sizeof(int)
+                  << " байт), выделений: " << heap_allocations - allocations_before << std::endl;
+
+        measure("обход", [&] {
+            long long sum = 0;
+            for (int value : container) sum += value;
+            return sum;
+        });
+    }
+    {
+        Container container;
+        fill(container, middle_base);
+        measure("вставка в середину", [&] { return insertInMiddle(container, middle_base, middle_inserts); });
+    }
+}
+
+/**
+ * Основная функция - развернутый список против стандартных контейнеров
+ *
+ * Аргументы: [количество элементов] (по умолчанию 10 000 000)
+ */
+int main(int argc, char** argv) {
+    size_t element_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    const size_t middle_base = 1'000'000;
+    const size_t middle_inserts = 10'000;
+
+    std::cout << "=== РАЗВЕРНУТЫЙ СВЯЗНЫЙ СПИСОК ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ИНТЕРФЕЙС КАК У LIST
+    // ========================================================================
+    std::cout << "\n1. Вставка и удаление через итераторы:" << std::endl;
+    mai::UnrolledList<int, 4> small_list;
+    for (int value = 1; value <= 6; ++value) small_list.push_back(value);
+
+    auto third = std::next(small_list.begin(), 2);
+    small_list.insert(third, 101);  // узел {1,2,3,4} полон - делится пополам
+    for (auto iterator = small_list.begin(); iterator != small_list.end(); ) {
+        if (*iterator % 2 == 0) iterator = small_list.erase(iterator);
+        else ++iterator;
+    }
+    std::cout << "   ";
+    for (int value : small_list) std::cout << value << " ";
+    std::cout << "(узлов: " << small_list.node_count() << ", размер: " << small_list.size() << ")" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: СРАВНЕНИЕ С STD::LIST, STD::FORWARD_LIST, STD::VECTOR
+    // ========================================================================
+    using unrolled_type = mai::UnrolledList<int>;
+    std::cout << "\n2. " << element_count << " элементов (заполнение и обход), "
+              << middle_inserts << " вставок в середину контейнера из " << middle_base << " элементов" << std::endl;
+    std::cout << "   UnrolledList<int>: " << unrolled_type::node_capacity() << " элементов в узле, узел "
+              << unrolled_type::node_bytes() << " байт" << std::endl;
+
+    benchmarkContainer<unrolled_type>("mai::UnrolledList", element_count, middle_base, middle_inserts);
+    benchmarkContainer<std::list<int>>("std::list", element_count, middle_base, middle_inserts);
+    benchmarkContainer<std::forward_list<int>>("std::forward_list", element_count, middle_base, middle_inserts);
+    benchmarkContainer<std::vector<int>>("std::vector", element_count, middle_base, middle_inserts);
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,356 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+
+namespace mai {
+
+    /**
+     * Вместимость узла по умолчанию: около 512 байт элементов, от 8 до 64 штук
+     */
+    template <class T>
+    constexpr size_t default_node_capacity() {
+        return std::clamp<size_t>(512 / sizeof(T), 8, 64);
+    }
+
+    /**
+     * Развернутый связный список (unrolled linked list)
+     *
+     * Каждый узел хранит не один элемент, а массив до NODE_CAPACITY элементов.
+     * Обход идет по соседним ячейкам памяти, и промах кэша случается один раз
+     * на узел, а не на каждый элемент, как у std::list.
+     *
+     * Элемент занимает в узле постоянный слот. Порядок элементов задается
+     * отдельным массивом order (номера слотов), а position - обратное
+     * отображение слот -> место в order. Поэтому вставка и удаление внутри
+     * узла сдвигают только байты order, а сами элементы остаются на месте.
+     *
+     * Инвалидация итераторов:
+     * - insert/erase без разделения и слияния узлов не трогают итераторы
+     *   на другие элементы
+     * - при разделении полного узла переезжает его вторая половина
+     * - при слиянии переезжают элементы меньшего из двух узлов
+     * Итераторы на переехавшие элементы становятся недействительными.
+     * insert и erase всегда возвращают действительный итератор.
+     *
+     * @tparam T - тип элементов
+     * @tparam NODE_CAPACITY - число элементов в узле (от 2 до 64)
+     */
+    template <class T, size_t NODE_CAPACITY = default_node_capacity<T>()>
+    class UnrolledList {
+        static_assert(NODE_CAPACITY >= 2 && NODE_CAPACITY <= 64, "Вместимость узла: от 2 до 64");
+
+    private:
+        struct Node {
+            Node* prev = nullptr;
+            Node* next = nullptr;
+            uint64_t free_mask = NODE_CAPACITY == 64 ? ~uint64_t{0} : (uint64_t{1} << NODE_CAPACITY) - 1;
+            uint8_t size = 0;
+            uint8_t order[NODE_CAPACITY];     // слоты в порядке следования элементов
+            uint8_t position[NODE_CAPACITY];  // место слота в order
+            alignas(T) unsigned char storage[NODE_CAPACITY * sizeof(T)];
+
+            T* slot(size_t slot_index) {
+                return std::launder(reinterpret_cast<T*>(storage) + slot_index);
+            }
+
+            bool full() const { return size == NODE_CAPACITY; }
+
+            /**
+             * Создание элемента на месте place в порядке следования
+             * Узел не должен быть полным
+             * @return номер слота нового элемента
+             */
+            template <class... Args>
+            uint8_t emplace_at(size_t place, Args&&... args) {
+                uint8_t slot_index = static_cast<uint8_t>(__builtin_ctzll(free_mask));
+                ::new (static_cast<void*>(storage + slot_index * sizeof(T))) T(std::forward<Args>(args)...);
+                free_mask &= ~(uint64_t{1} << slot_index);
+
+                std::memmove(order + place + 1, order + place, size - place);
+                order[place] = slot_index;
+                ++size;
+                for (size_t order_index = place; order_index < size; ++order_index)
+                    position[order[order_index]] = static_cast<uint8_t>(order_index);
+                return slot_index;
+            }
+
+            /**
+             * Разрушение элемента на месте place в порядке следования
+             */
+            void erase_at(size_t place) {
+                uint8_t slot_index = order[place];
+                std::destroy_at(slot(slot_index));
+                free_mask |= uint64_t{1} << slot_index;
+
+                std::memmove(order + place, order + place + 1, size - place - 1);
+                --size;
+                for (size_t order_index = place; order_index < size; ++order_index)
+                    position[order[order_index]] = static_cast<uint8_t>(order_index);
+            }
+        };
+
+        Node*  head = nullptr;
+        Node*  tail = nullptr;
+        size_t count = 0;
+
+        // Позиция элемента: узел и слот. Служит и итератором, и внутренней ссылкой
+        struct Cursor {
+            Node*   node = nullptr;
+            uint8_t slot = 0;
+        };
+
+        Node* create_node_after(Node* previous) {
+            Node* node = new Node;
+            node->prev = previous;
+            node->next = previous ? previous->next : head;
+            if (node->next) node->next->prev = node;
+            else tail = node;
+            if (previous) previous->next = node;
+            else head = node;
+            return node;
+        }
+
+        void unlink_node(Node* node) {
+            if (node->prev) node->prev->next = node->next;
+            else head = node->next;
+            if (node->next) node->next->prev = node->prev;
+            else tail = node->prev;
+            delete node;
+        }
+
+        /**
+         * Перенос элементов source[first, source->size) в конец target
+         * Если tracked указывает на переносимый элемент, он обновляется
+         */
+        void move_elements(Node* source, size_t first, Node* target, size_t target_place, Cursor& tracked) {
+            size_t moved_count = source->size - first;
+            for (size_t moved_index = 0; moved_index < moved_count; ++moved_index) {
+                uint8_t source_slot = source->order[first];
+                uint8_t target_slot = target->emplace_at(target_place + moved_index, std::move(*source->slot(source_slot)));
+                if (tracked.node == source && tracked.slot == source_slot)
+                    tracked = Cursor{target, target_slot};
+                source->erase_at(first);
+            }
+        }
+
+        /**
+         * Разделение полного узла: вторая половина переезжает в новый узел
+         */
+        Node* split(Node* node, Cursor& tracked) {
+            Node* half = create_node_after(node);
+            move_elements(node, NODE_CAPACITY / 2, half, 0, tracked);
+            return half;
+        }
+
+        /**
+         * Слияние недозаполненного узла с соседом
+         * Переезжают элементы меньшего из двух узлов
+         */
+        void merge_if_underfull(Node* node, Cursor& tracked) {
+            if (node->size == 0) {
+                unlink_node(node);
+                return;
+            }
+            if (node->size >= NODE_CAPACITY / 4) return;
+
+            Node* neighbour = node->next ? node->next : node->prev;
+            if (!neighbour || node->size + neighbour->size > NODE_CAPACITY * 3 / 4) return;
+
+            Node* smaller = node->size <= neighbour->size ? node : neighbour;
+            Node* larger = smaller == node ? neighbour : node;
+            size_t target_place = smaller == larger->prev ? 0 : larger->size;
+            move_elements(smaller, 0, larger, target_place, tracked);
+            unlink_node(smaller);
+        }
+
+        static Cursor first_of(Node* node) {
+            return node ? Cursor{node, node->order[0]} : Cursor{};
+        }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+
+        /**
+         * Прямой итератор, интерфейс как у List::ListIterator из 03_UniqueIterator
+         */
+        class Iterator {
+        private:
+            Cursor cursor;
+            friend class UnrolledList;
+
+            explicit Iterator(Cursor c) : cursor(c) {}
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = T;
+            using reference = T&;
+            using pointer = T*;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator() = default;
+
+            Iterator& operator++() {
+                Node* node = cursor.node;
+                size_t next_place = node->position[cursor.slot] + 1;
+                if (next_place < node->size) cursor.slot = node->order[next_place];
+                else cursor = first_of(node->next);
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            reference operator*() const { return *cursor.node->slot(cursor.slot); }
+            pointer operator->() const { return cursor.node->slot(cursor.slot); }
+
+            bool operator==(const Iterator& other) const {
+                return cursor.node == other.cursor.node && cursor.slot == other.cursor.slot;
+            }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+        };
+
+        using ListIterator = Iterator;
+
+        UnrolledList() = default;
+
+        UnrolledList(const UnrolledList& other) {
+            for (Node* node = other.head; node; node = node->next)
+                for (size_t place = 0; place < node->size; ++place)
+                    push_back(*node->slot(node->order[place]));
+        }
+
+        UnrolledList(UnrolledList&& other) noexcept
+            : head(std::exchange(other.head, nullptr)),
+              tail(std::exchange(other.tail, nullptr)),
+              count(std::exchange(other.count, 0)) {}
+
+        UnrolledList& operator=(UnrolledList other) noexcept {
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(count, other.count);
+            return *this;
+        }
+
+        ~UnrolledList() { clear(); }
+
+        void clear() noexcept {
+            Node* node = head;
+            while (node) {
+                Node* next = node->next;
+                for (size_t place = 0; place < node->size; ++place)
+                    std::destroy_at(node->slot(node->order[place]));
+                delete node;
+                node = next;
+            }
+            head = tail = nullptr;
+            count = 0;
+        }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        Iterator begin() { return Iterator(first_of(head)); }
+        Iterator end() { return Iterator(Cursor{}); }
+
+        /**
+         * Вставка перед итератором
+         * @return итератор на вставленный элемент
+         */
+        template <class... Args>
+        Iterator emplace(Iterator where, Args&&... args) {
+            Cursor tracked = where.cursor;
+            Node* node;
+            size_t place;
+
+            if (!tracked.node) {
+                // Вставка в конец: полный последний узел не делится,
+                // а дополняется новым - так push_back заполняет узлы целиком
+                if (!tail || tail->full()) create_node_after(tail);
+                node = tail;
+                place = node->size;
+            } else {
+                if (tracked.node->full()) split(tracked.node, tracked);
+                node = tracked.node;
+                place = node->position[tracked.slot];
+            }
+
+            uint8_t slot_index;
+            try {
+                slot_index = node->emplace_at(place, std::forward<Args>(args)...);
+            } catch (...) {
+                // Пустым бывает только что созданный узел - он не должен остаться в списке
+                if (node->size == 0) unlink_node(node);
+                throw;
+            }
+            ++count;
+            return Iterator(Cursor{node, slot_index});
+        }
+
+        Iterator insert(Iterator where, const T& value) { return emplace(where, value); }
+        Iterator insert(Iterator where, T&& value) { return emplace(where, std::move(value)); }
+
+        /**
+         * Удаление элемента
+         * @return итератор на следующий элемент
+         */
+        Iterator erase(Iterator where) {
+            Cursor removed = where.cursor;
+            if (!removed.node) throw std::logic_error("Out of bounds");
+
+            Node* node = removed.node;
+            size_t place = node->position[removed.slot];
+            Cursor following = place + 1 < node->size ? Cursor{node, node->order[place + 1]} : first_of(node->next);
+
+            node->erase_at(place);
+            --count;
+            merge_if_underfull(node, following);
+            return Iterator(following);
+        }
+
+        template <class... Args>
+        T& emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+
+        void push_back(const T& value) { emplace(end(), value); }
+        void push_back(T&& value) { emplace(end(), std::move(value)); }
+        void push_front(const T& value) { emplace(begin(), value); }
+
+        /**
+         * Доступ по индексу: узлы пропускаются целиком - O(n / NODE_CAPACITY)
+         */
+        T& operator[](size_t index) {
+            if (index >= count) throw std::logic_error("Out of bounds");
+            Node* node = head;
+            while (index >= node->size) {
+                index -= node->size;
+                node = node->next;
+            }
+            return *node->slot(node->order[index]);
+        }
+
+        /**
+         * Количество узлов - для оценки заполненности и расхода памяти
+         */
+        size_t node_count() const {
+            size_t nodes = 0;
+            for (Node* node = head; node; node = node->next) ++nodes;
+            return nodes;
+        }
+
+        static constexpr size_t node_bytes() { return sizeof(Node); }
+        static constexpr size_t node_capacity() { return NODE_CAPACITY; }
+    };
+}
+
+#endif // UNROLLED_LIST_H
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <cstdlib>
+
+#include "../02_Iterator/dynamic_array.h"
+
+/**
+ * Прежний итератор из 02_Iterator: указатель на массив и индекс
+ * Каждое разыменование проверяет индекс и вызывает DynamicArray::operator[],
+ * который проверяет его еще раз и может выбросить исключение
+ */
+template <class ArrayType>
+class LegacyArrayIterator {
+private:
+    ArrayType* array_pointer;
+    size_t current_index;
+    size_t array_size;
+
+public:
+    LegacyArrayIterator(ArrayType* array_pointer, size_t start_index, size_t array_size)
+        : array_pointer(array_pointer), current_index(start_index), array_size(array_size) {
+    }
+
+    typename ArrayType::item_type operator*() {
+        if (current_index >= array_size) {
+            throw OutOfBoundException();
+        }
+        return (*array_pointer)[current_index];
+    }
+
+    bool operator!=(const LegacyArrayIterator& other) const {
+        return (other.current_index != current_index) || (other.array_pointer != array_pointer);
+    }
+
+    LegacyArrayIterator& operator++() {
+        ++current_index;
+        return *this;
+    }
+};
+
+/**
+ * Измерение времени выполнения функции
+ *
+ * @param name - название варианта для вывода
+ * @param function - измеряемое действие, возвращает контрольное значение
+ */
+template <typename Function>
+void measure(const char* name, Function function) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long checksum = function();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    std::cout << "   " << name << ": " << duration.count() << " мс (контрольная сумма " << checksum << ")" << std::endl;
+}
+
+/**
+ * Сумма и преобразование через operator[] для заданной политики доступа
+ *
+ * @param source - исходный массив
+ * @param target - массив для результата того же размера
+ */
+template <class Policy>
+void benchmarkIndexAccess(DynamicArray<int, Policy>& source, DynamicArray<int, Policy>& target) {
+    measure("сумма, operator[]", [&] {
+        long long sum = 0;
+        for (size_t element_index = 0; element_index < source.size(); ++element_index)
+            sum += source[element_index];
+        return sum;
+    });
+
+    measure("преобразование, operator[]", [&] {
+        for (size_t element_index = 0; element_index < source.size(); ++element_index)
+            target[element_index] = source[element_index] * 3 + 1;
+        return static_cast<long long>(target[target.size() - 1]);
+    });
+}
+
+/**
+ * Сумма и преобразование через итераторы: range-based for и std::ranges
+ * Итератор одинаков для обеих политик, поэтому замер делается один раз
+ */
+void benchmarkIterators(DynamicArray<int>& source, DynamicArray<int>& target) {
+    measure("сумма, range-based for", [&] {
+        long long sum = 0;
+        for (int element : source)
+            sum += element;
+        return sum;
+    });
+
+    measure("сумма, std::reduce", [&] {
+        return std::reduce(source.begin(), source.end(), 0LL);
+    });
+
+    measure("преобразование, std::ranges::transform", [&] {
+        std::ranges::transform(source, target.begin(), [](int element) { return element * 3 + 1; });
+        return static_cast<long long>(target[target.size() - 1]);
+    });
+}
+
+/**
+ * Основная функция - сравнение прежнего индексного итератора, доступа по индексу
+ * с проверкой и без нее и итератора-указателя
+ */
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000'000;
+    std::cout << "=== ПРОИЗВОДИТЕЛЬНОСТЬ ИТЕРАТОРА DynamicArray (" << count << " элементов) ===" << std::endl;
+
+    DynamicArray<int> source(count);
+    DynamicArray<int> target(count);
+    for (size_t element_index = 0; element_index < count; ++element_index)
+        source[element_index] = static_cast<int>(element_index % 1000);
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ПРЕЖНИЙ ИТЕРАТОР (ИНДЕКС + ДВЕ ПРОВЕРКИ НА ЭЛЕМЕНТ)
+    // ========================================================================
+    std::cout << "\n1. Прежний ArrayIterator (индекс, operator[] с проверкой):" << std::endl;
+    measure("сумма, range-based for", [&] {
+        long long sum = 0;
+        LegacyArrayIterator<DynamicArray<int>> iterator(&source, 0, count);
+        LegacyArrayIterator<DynamicArray<int>> end(&source, count, count);
+        for (; iterator != end; ++iterator)
+            sum += *iterator;
+        return sum;
+    });
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: ДОСТУП ПО ИНДЕКСУ С ПРОВЕРКОЙ ГРАНИЦ
+    // ========================================================================
+    std::cout << "\n2. CheckedAccess:" << std::endl;
+    benchmarkIndexAccess(source, target);
+
+    DynamicArray<int, UncheckedAccess> unchecked_source(count);
+    DynamicArray<int, UncheckedAccess> unchecked_target(count);
+    std::ranges::copy(source, unchecked_source.begin());
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ТЕ ЖЕ ЦИКЛЫ БЕЗ ПРОВЕРКИ ГРАНИЦ
+    // ========================================================================
+    std::cout << "\n3. UncheckedAccess:" << std::endl;
+    benchmarkIndexAccess(unchecked_source, unchecked_target);
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 4: ИТЕРАТОР-УКАЗАТЕЛЬ (CONTIGUOUS ITERATOR)
+    // ========================================================================
+    std::cout << "\n4. Новый ArrayIterator (указатель):" << std::endl;
+    benchmarkIterators(source, target);
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,427 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mai {
+    /**
+     * Счетчики одного контейнера: выделения памяти и то, как элементы
+     * попадали в его память
+     *
+     * Перераспределение - это новое выделение, после которого элементы
+     * переезжают из еще живого прежнего блока (как при росте vector).
+     * Узловые контейнеры (list, map) элементы не переносят, поэтому
+     * перераспределений у них не бывает.
+     */
+    struct trace_snapshot {
+        std::string tag;
+        uint64_t allocations = 0;
+        uint64_t deallocations = 0;
+        uint64_t allocated_bytes = 0;
+        uint64_t peak_bytes = 0;
+        uint64_t reallocations = 0;
+        uint64_t emplacements = 0;        // Создание на месте из аргументов конструктора
+        uint64_t copy_insertions = 0;     // Копия внешнего объекта
+        uint64_t move_insertions = 0;     // Перемещение внешнего объекта
+        uint64_t relocation_copies = 0;   // Копирование при перераспределении
+        uint64_t relocation_moves = 0;    // Перемещение при перераспределении
+        uint64_t bytes_relocated = 0;
+
+        std::string to_text() const {
+            std::ostringstream out;
+            out << "[" << tag << "] allocations: " << allocations
+                << ", deallocations: " << deallocations
+                << ", allocated: " << allocated_bytes << " B"
+                << ", peak: " << peak_bytes << " B\n"
+                << "    reallocations: " << reallocations
+                << ", relocated: " << relocation_moves << " moves + " << relocation_copies << " copies"
+                << " (" << bytes_relocated << " B)\n"
+                << "    inserted: " << emplacements << " emplaced, "
+                << move_insertions << " moved, " << copy_insertions << " copied\n";
+            if (relocation_copies)
+                out << "    WARNING: elements are copied on reallocation - is the move constructor noexcept?\n";
+            return out.str();
+        }
+    };
+
+    /**
+     * Статистика одного экземпляра контейнера
+     *
+     * Создается tracing_allocator и живет, пока жива хоть одна копия
+     * аллокатора (то есть сам контейнер). Все живые объекты регистрируются,
+     * report_text() выводит их все. Если задан поток для отчета
+     * (set_report_stream), итог контейнера печатается при его разрушении.
+     *
+     * Счетчики обычные, без атомиков: контейнер и так нельзя изменять
+     * из нескольких потоков без внешней синхронизации.
+     */
+    class trace_stats {
+    private:
+        struct Block {
+            const void* begin = nullptr;
+            size_t bytes = 0;
+
+            bool contains(const void* pointer) const {
+                auto address = reinterpret_cast<uintptr_t>(pointer);
+                auto start = reinterpret_cast<uintptr_t>(begin);
+                return address >= start && address < start + bytes;
+            }
+
+            uintptr_t offset_of(const void* pointer) const {
+                return reinterpret_cast<uintptr_t>(pointer) - reinterpret_cast<uintptr_t>(begin);
+            }
+        };
+
+        trace_snapshot counters;
+        uint64_t live_bytes = 0;
+        Block current_block;              // Последний выделенный блок
+        Block previous_block;             // Предыдущий, пока он не освобожден
+        bool relocation_counted = false;  // Перераспределение в previous_block уже учтено
+        bool first_transfer = true;       // В current_block еще ничего не копировалось
+
+        struct Registry {
+            std::mutex mtx;
+            std::vector<trace_stats*> stats;
+            std::ostream* report_stream = nullptr;
+        };
+
+        static Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+    public:
+        explicit trace_stats(std::string tag) {
+            counters.tag = std::move(tag);
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            all.stats.push_back(this);
+        }
+
+        trace_stats(const trace_stats&) = delete;
+        trace_stats& operator=(const trace_stats&) = delete;
+
+        ~trace_stats() {
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            all.stats.erase(std::find(all.stats.begin(), all.stats.end(), this));
+            if (all.report_stream) *all.report_stream << counters.to_text();
+        }
+
+        const trace_snapshot& snapshot() const { return counters; }
+        const std::string& tag() const { return counters.tag; }
+
+        /**
+         * Поток для итогов разрушаемых контейнеров (nullptr - не печатать)
+         */
+        static void set_report_stream(std::ostream* stream) {
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            all.report_stream = stream;
+        }
+
+        /**
+         * Статистика всех живых контейнеров, по убыванию перенесенных байт
+         */
+        static std::vector<trace_snapshot> snapshot_all() {
+            std::vector<trace_snapshot> result;
+            {
+                Registry& all = registry();
+                std::lock_guard<std::mutex> lock(all.mtx);
+                for (const trace_stats* stats : all.stats) result.push_back(stats->counters);
+            }
+            std::sort(result.begin(), result.end(), [](const auto& left, const auto& right) {
+                return left.bytes_relocated > right.bytes_relocated;
+            });
+            return result;
+        }
+
+        static std::string report_text() {
+            std::string out;
+            for (const trace_snapshot& snapshot : snapshot_all()) out += snapshot.to_text();
+            return out;
+        }
+
+        void on_allocate(const void* pointer, size_t bytes) {
+            ++counters.allocations;
+            counters.allocated_bytes += bytes;
+            live_bytes += bytes;
+            counters.peak_bytes = std::max(counters.peak_bytes, live_bytes);
+            previous_block = current_block;
+            current_block = Block{pointer, bytes};
+            relocation_counted = false;
+            first_transfer = true;
+        }
+
+        void on_deallocate(const void* pointer, size_t bytes) {
+            ++counters.deallocations;
+            live_bytes -= bytes;
+            if (pointer == previous_block.begin) previous_block = Block{};
+            if (pointer == current_block.begin) current_block = Block{};
+        }
+
+        /**
+         * Перенос ли это элемента при перераспределении: источник в прежнем
+         * блоке, цель в новом на том же месте (или на одно дальше - элементы
+         * после точки вставки). Вставка при перераспределении (libstdc++)
+         * сначала создает новый элемент и только потом переносит старые,
+         * поэтому первое создание в новом блоке - перенос, только если это
+         * элемент 0 на место 0. Иначе v.push_back(v[i]) в полный вектор -
+         * копия из еще живого прежнего блока - считалась бы переносом
+         */
+        bool is_relocation(const void* source, const void* target, size_t bytes) const {
+            if (!previous_block.begin || !previous_block.contains(source) || !current_block.contains(target))
+                return false;
+            uintptr_t from = previous_block.offset_of(source);
+            uintptr_t to = current_block.offset_of(target);
+            if (first_transfer) return from == 0 && to == 0;
+            return to == from || to == from + bytes;
+        }
+
+        /**
+         * Элемент размером bytes создан в target копией или перемещением объекта source
+         */
+        void on_transfer(const void* source, const void* target, size_t bytes, bool moved) {
+            bool relocation = is_relocation(source, target, bytes);
+            first_transfer = false;
+            if (relocation) {
+                if (!relocation_counted) {
+                    ++counters.reallocations;
+                    relocation_counted = true;
+                }
+                ++(moved ? counters.relocation_moves : counters.relocation_copies);
+                counters.bytes_relocated += bytes;
+            } else {
+                ++(moved ? counters.move_insertions : counters.copy_insertions);
+            }
+        }
+
+        void on_emplace() {
+            ++counters.emplacements;
+        }
+    };
+
+    /**
+     * Аллокатор, который считает выделения и перенос элементов для
+     * одного контейнера
+     *
+     * Память выделяет std::allocator. Все создания элементов проходят через
+     * construct: если аргумент - объект того же типа, это копирование
+     * или перемещение, и по адресу источника видно, переезжает ли элемент
+     * из прежнего блока этого же контейнера.
+     *
+     * Копия контейнера получает собственную статистику с пометкой "(copy)",
+     * перемещение контейнера забирает статистику вместе с памятью.
+     *
+     * @tparam T - тип элементов
+     */
+    template <class T>
+    class tracing_allocator {
+    private:
+        std::shared_ptr<trace_stats> stats;
+
+        template <class U>
+        friend class tracing_allocator;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        explicit tracing_allocator(std::string tag = "container")
+            : stats(std::make_shared<trace_stats>(std::move(tag))) {
+        }
+
+        template <class U>
+        tracing_allocator(const tracing_allocator<U>& other) noexcept : stats(other.stats) {
+        }
+
+        tracing_allocator select_on_container_copy_construction() const {
+            return tracing_allocator(stats->tag() + " (copy)");
+        }
+
+        T* allocate(size_t count) {
+            T* pointer = std::allocator<T>().allocate(count);
+            stats->on_allocate(pointer, count * sizeof(T));
+            return pointer;
+        }
+
+        void deallocate(T* pointer, size_t count) noexcept {
+            stats->on_deallocate(pointer, count * sizeof(T));
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template <class U, class... Args>
+        void construct(U* pointer, Args&&... args) noexcept(std::is_nothrow_constructible_v<U, Args...>) {
+            if constexpr ((sizeof...(Args) == 1) && (std::is_same_v<std::remove_cvref_t<Args>, U> && ...)) {
+                // Единственный аргумент того же типа: U&& - перемещение, U& и const U& - копирование
+                constexpr bool moved = (!std::is_lvalue_reference_v<Args> && ...);
+                (stats->on_transfer(std::addressof(args), pointer, sizeof(U), moved), ...);
+            } else {
+                stats->on_emplace();
+            }
+            ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+        }
+
+        const trace_stats& statistics() const { return *stats; }
+
+        template <class U>
+        bool operator==(const tracing_allocator<U>& other) const noexcept {
+            return stats == other.stats;
+        }
+    };
+
+    /**
+     * Счетчики специальных функций-членов traced<T>
+     */
+    struct element_counters {
+        uint64_t copy_constructions = 0;
+        uint64_t move_constructions = 0;
+        uint64_t copy_assignments = 0;
+        uint64_t move_assignments = 0;
+
+        std::string to_text(const std::string& name) const {
+            std::ostringstream out;
+            out << "[" << name << "] copy constructions: " << copy_constructions
+                << ", move constructions: " << move_constructions
+                << ", copy assignments: " << copy_assignments
+                << ", move assignments: " << move_assignments << "\n";
+            return out.str();
+        }
+    };
+
+    /**
+     * Обертка над элементом, которая считает копирования и перемещения
+     *
+     * Дополняет tracing_allocator: аллокатор видит только создание элементов
+     * в памяти контейнера, а обертка - и присваивания (сдвиг элементов при
+     * insert/erase в середине, сортировку), и копии вне контейнера.
+     * Счетчики общие для всех traced<T> с одним T. Как в tracking_resource,
+     * у каждого потока свой шард счетчиков, который обновляется без
+     * lock-префикса; counters() складывает шарды всех потоков.
+     * noexcept у перемещения такой же, как у T, поэтому обертка
+     * не меняет поведение контейнера.
+     *
+     * @tparam T - тип значения
+     */
+    template <class T>
+    class traced {
+    private:
+        T item;
+
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> copy_constructions{0};
+            std::atomic<uint64_t> move_constructions{0};
+            std::atomic<uint64_t> copy_assignments{0};
+            std::atomic<uint64_t> move_assignments{0};
+        };
+
+        // Шарды не удаляются с завершением потока, чтобы его счетчики
+        // оставались в сумме
+        struct Registry {
+            std::mutex mtx;
+            std::vector<std::unique_ptr<Shard>> shards;
+        };
+
+        static Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        static Shard& local_shard() {
+            thread_local Shard* shard = [] {
+                Registry& all = registry();
+                std::lock_guard<std::mutex> lock(all.mtx);
+                all.shards.push_back(std::make_unique<Shard>());
+                return all.shards.back().get();
+            }();
+            return *shard;
+        }
+
+        // Шард пишет только его поток, поэтому достаточно load + store
+        static void count(std::atomic<uint64_t> Shard::* counter) noexcept {
+            std::atomic<uint64_t>& value = local_shard().*counter;
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+    public:
+        // Копия traced всегда идет через счетный конструктор копирования,
+        // а не через преобразование traced -> T&
+        template <class... Args>
+            requires std::is_constructible_v<T, Args...>
+                && (sizeof...(Args) != 1 || (!std::is_same_v<std::remove_cvref_t<Args>, traced> && ...))
+        traced(Args&&... args) : item(std::forward<Args>(args)...) {
+        }
+
+        traced(const traced& other) : item(other.item) {
+            count(&Shard::copy_constructions);
+        }
+
+        traced(traced&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : item(std::move(other.item)) {
+            count(&Shard::move_constructions);
+        }
+
+        traced& operator=(const traced& other) {
+            item = other.item;
+            count(&Shard::copy_assignments);
+            return *this;
+        }
+
+        traced& operator=(traced&& other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+            item = std::move(other.item);
+            count(&Shard::move_assignments);
+            return *this;
+        }
+
+        T& value() noexcept { return item; }
+        const T& value() const noexcept { return item; }
+
+        // Неявное преобразование - чтобы обертку можно было подставить
+        // в существующий код, не переписывая обращения к элементам
+        operator T&() noexcept { return item; }
+        operator const T&() const noexcept { return item; }
+
+        friend bool operator==(const traced& left, const traced& right) { return left.item == right.item; }
+        friend auto operator<=>(const traced& left, const traced& right) { return left.item <=> right.item; }
+
+        static element_counters counters() {
+            element_counters result;
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            for (const auto& shard : all.shards) {
+                result.copy_constructions += shard->copy_constructions.load(std::memory_order_relaxed);
+                result.move_constructions += shard->move_constructions.load(std::memory_order_relaxed);
+                result.copy_assignments += shard->copy_assignments.load(std::memory_order_relaxed);
+                result.move_assignments += shard->move_assignments.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        /**
+         * Обнуление счетчиков. Вызывать, пока другие потоки не работают с traced<T>
+         */
+        static void reset_counters() {
+            Registry& all = registry();
+            std::lock_guard<std::mutex> lock(all.mtx);
+            for (const auto& shard : all.shards) {
+                shard->copy_constructions.store(0, std::memory_order_relaxed);
+                shard->move_constructions.store(0, std::memory_order_relaxed);
+                shard->copy_assignments.store(0, std::memory_order_relaxed);
+                shard->move_assignments.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+}
@@ -0,0 +1,173 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <map>
+#include <string>
+#include <chrono>
+
+#include "container_tracing.h"
+
+/**
+ * Структура из 01_Vector/testCustomObjectReallocation, но без noexcept
+ * у конструктора перемещения: vector не может перемещать такие элементы
+ * при росте (строгая гарантия исключений) и копирует их
+ */
+struct Record {
+    explicit Record(int initial_value) : value{initial_value}, name(64, 'r') {
+    }
+    Record(const Record&) = default;
+    Record(Record&& other) : value{other.value}, name(std::move(other.name)) {
+    }
+    Record& operator=(const Record&) = default;
+    Record& operator=(Record&&) = default;
+
+    int value;
+    std::string name;
+};
+
+/**
+ * Та же структура с noexcept-перемещением
+ */
+struct NoexceptRecord {
+    explicit NoexceptRecord(int initial_value) : value{initial_value}, name(64, 'r') {
+    }
+
+    int value;
+    std::string name;
+};
+
+template <class T>
+using traced_vector = std::vector<T, mai::tracing_allocator<T>>;
+
+/**
+ * Заполнение вектора - нагрузка для замера накладных расходов
+ * Элементы создаются из значения element_index через make_element
+ */
+template <class Vector, class MakeElement>
+void fillVector(Vector& items, int elements, MakeElement make_element) {
+    for (int element_index = 0; element_index < elements; ++element_index) items.push_back(make_element(element_index));
+}
+
+/**
+ * Лучшее время из нескольких запусков, в микросекундах
+ */
+template <class Function>
+long long bestTime(Function function) {
+    long long best = -1;
+    for (int run_index = 0; run_index < 5; ++run_index) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        function();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        long long elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+        if (best < 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+/**
+ * Сравнение std::vector без трассировки, с tracing_allocator и с traced<T>
+ */
+template <class T, class MakeElement>
+void compareOverhead(const char* name, int elements, MakeElement make_element) {
+    long long plain_time = bestTime([&] {
+        std::vector<T> items;
+        fillVector(items, elements, make_element);
+    });
+    long long allocator_time = bestTime([&] {
+        traced_vector<T> items(mai::tracing_allocator<T>("overhead"));
+        fillVector(items, elements, make_element);
+    });
+    long long wrapper_time = bestTime([&] {
+        traced_vector<mai::traced<T>> items(mai::tracing_allocator<mai::traced<T>>("overhead"));
+        fillVector(items, elements, make_element);
+    });
+    std::cout << "   " << name << ":" << std::endl;
+    std::cout << "      std::vector:                  " << plain_time << " мкс" << std::endl;
+    std::cout << "      + tracing_allocator:          " << allocator_time << " мкс ("
+              << std::showpos << (allocator_time - plain_time) * 100 / plain_time << std::noshowpos << "%)" << std::endl;
+    std::cout << "      + tracing_allocator, traced:  " << wrapper_time << " мкс ("
+              << std::showpos << (wrapper_time - plain_time) * 100 / plain_time << std::noshowpos << "%)" << std::endl;
+}
+
+/**
+ * Основная функция - демонстрация трассировки копирований и перемещений
+ */
+int main() {
+    std::cout << "=== ТРАССИРОВКА КОПИРОВАНИЙ И ПЕРЕРАСПРЕДЕЛЕНИЙ ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ЗАБЫТЫЙ NOEXCEPT У КОНСТРУКТОРА ПЕРЕМЕЩЕНИЯ
+    // ========================================================================
+    std::cout << "\n1. Рост вектора и noexcept у перемещения:" << std::endl;
+    {
+        traced_vector<Record> records(mai::tracing_allocator<Record>("Record, move без noexcept"));
+        traced_vector<NoexceptRecord> noexcept_records(mai::tracing_allocator<NoexceptRecord>("NoexceptRecord"));
+        for (int element_index = 0; element_index < 1000; ++element_index) {
+            records.emplace_back(element_index);
+            noexcept_records.emplace_back(element_index);
+        }
+        std::cout << mai::trace_stats::report_text();
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: RESERVE УБИРАЕТ ПЕРЕРАСПРЕДЕЛЕНИЯ
+    // ========================================================================
+    std::cout << "\n2. reserve перед заполнением:" << std::endl;
+    {
+        traced_vector<NoexceptRecord> reserved(mai::tracing_allocator<NoexceptRecord>("reserve(1000)"));
+        reserved.reserve(1000);
+        for (int element_index = 0; element_index < 1000; ++element_index) reserved.emplace_back(element_index);
+        std::cout << reserved.get_allocator().statistics().snapshot().to_text();
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ОБЕРТКА TRACED - ПРИСВАИВАНИЯ И КОПИИ ВНЕ КОНТЕЙНЕРА
+    // ========================================================================
+    // Аллокатор не видит сдвиг элементов при вставке в середину:
+    // это присваивания, их считает обертка
+    std::cout << "\n3. Вставка в середину и push_back lvalue:" << std::endl;
+    {
+        using Element = mai::traced<std::string>;
+        traced_vector<Element> words(mai::tracing_allocator<Element>("words"));
+        words.reserve(200);
+        for (int element_index = 0; element_index < 100; ++element_index) words.emplace_back("word");
+
+        Element::reset_counters();
+        Element inserted("inserted");
+        words.insert(words.begin(), inserted);   // копия + сдвиг 100 элементов
+        words.push_back(inserted);               // копия lvalue
+        words.push_back(std::move(inserted));    // перемещение
+        std::cout << Element::counters().to_text("traced<std::string>");
+        std::cout << words.get_allocator().statistics().snapshot().to_text();
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 4: КОПИЯ КОНТЕЙНЕРА И УЗЛОВЫЕ КОНТЕЙНЕРЫ
+    // ========================================================================
+    std::cout << "\n4. Копия вектора, list и map, итог при разрушении:" << std::endl;
+    mai::trace_stats::set_report_stream(&std::cout);
+    {
+        traced_vector<int> original(mai::tracing_allocator<int>("original"));
+        for (int element_index = 0; element_index < 100; ++element_index) original.push_back(element_index);
+        traced_vector<int> copy = original;   // своя статистика "original (copy)"
+
+        std::list<int, mai::tracing_allocator<int>> events(mai::tracing_allocator<int>("event list"));
+        for (int element_index = 0; element_index < 100; ++element_index) events.push_back(element_index);
+
+        using MapAllocator = mai::tracing_allocator<std::pair<const int, std::string>>;
+        std::map<int, std::string, std::less<int>, MapAllocator> index{std::less<int>(), MapAllocator("index map")};
+        for (int element_index = 0; element_index < 10; ++element_index) index.emplace(element_index, "value");
+    }
+    mai::trace_stats::set_report_stream(nullptr);
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 5: НАКЛАДНЫЕ РАСХОДЫ
+    // ========================================================================
+    std::cout << "\n5. Накладные расходы (push_back):" << std::endl;
+    compareOverhead<int>("10 000 000 int", 10'000'000, [](int element_index) { return element_index; });
+    compareOverhead<std::string>("1 000 000 std::string", 1'000'000,
+                                 [](int element_index) { return std::string(40, char('a' + element_index % 26)); });
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
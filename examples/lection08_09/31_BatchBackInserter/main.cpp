@@ -0,0 +1,145 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <cstdlib>
+
+#include "../05_BackInsertIterator/batch_back_inserter.h"
+
+/**
+ * Итератор ввода, который выдает числа 0, 1, 2, ... - источник неизвестного
+ * заранее размера (как std::istream_iterator, но без разбора текста)
+ */
+class CountingInputIterator {
+private:
+    int current_value = 0;
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const int*;
+    using reference = int;
+
+    CountingInputIterator() = default;
+    explicit CountingInputIterator(int start_value) : current_value(start_value) {}
+
+    int operator*() const { return current_value; }
+    CountingInputIterator& operator++() { ++current_value; return *this; }
+    CountingInputIterator operator++(int) { CountingInputIterator previous = *this; ++current_value; return previous; }
+    bool operator==(const CountingInputIterator& other) const { return current_value == other.current_value; }
+};
+
+/**
+ * Измерение времени выполнения функции: лучшее из трех запусков,
+ * чтобы сгладить разброс из-за выделения страниц памяти
+ *
+ * @param name - название варианта для вывода
+ * @param function - измеряемое действие, возвращает контейнер-результат
+ */
+template <typename Function>
+void measure(const char* name, Function function) {
+    long long best_time = -1;
+    size_t result_size = 0;
+    long long last_element = 0;
+    for (int run_index = 0; run_index < 3; ++run_index) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        auto destination = function();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
+        if (best_time < 0 || elapsed < best_time) best_time = elapsed;
+        result_size = destination.size();
+        last_element = destination.empty() ? 0 : destination.back();
+    }
+    std::cout << "   " << name << ": " << best_time << " мс (элементов " << result_size
+              << ", последний " << last_element << ")" << std::endl;
+}
+
+/**
+ * Основная функция - сравнение поэлементного back_insert_iterator
+ * и пакетного batch_back_inserter
+ */
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000'000;
+    std::cout << "=== ПАКЕТНОЕ ДОБАВЛЕНИЕ В VECTOR (" << count << " элементов int) ===" << std::endl;
+
+    std::vector<int> source(count);
+    for (size_t element_index = 0; element_index < count; ++element_index)
+        source[element_index] = static_cast<int>(element_index);
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: COPY ДИАПАЗОНА ИЗВЕСТНОГО РАЗМЕРА
+    // ========================================================================
+    std::cout << "\n1. copy из vector:" << std::endl;
+    measure("std::copy + std::back_inserter (push_back на элемент)", [&] {
+        std::vector<int> destination;
+        std::copy(source.begin(), source.end(), std::back_inserter(destination));
+        return destination;
+    });
+    measure("std::copy + batch_back_inserter (буфер 1024)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination);
+        std::copy(source.begin(), source.end(), mai::batch_back_inserter(batch));
+        batch.flush();
+        return destination;
+    });
+    measure("copy + batch_back_inserter (ADL: reserve + insert)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination);
+        copy(source.begin(), source.end(), mai::batch_back_inserter(batch));
+        return destination;
+    });
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: TRANSFORM
+    // ========================================================================
+    std::cout << "\n2. transform (x * 3 + 1):" << std::endl;
+    auto operation = [](int element) { return element * 3 + 1; };
+    measure("std::transform + std::back_inserter", [&] {
+        std::vector<int> destination;
+        std::transform(source.begin(), source.end(), std::back_inserter(destination), operation);
+        return destination;
+    });
+    measure("std::transform + batch_back_inserter (буфер 1024)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination);
+        std::transform(source.begin(), source.end(), mai::batch_back_inserter(batch), operation);
+        batch.flush();
+        return destination;
+    });
+    measure("transform + batch_back_inserter (ADL: один reserve)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination);
+        transform(source.begin(), source.end(), mai::batch_back_inserter(batch), operation);
+        return destination;
+    });
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ИСТОЧНИК НЕИЗВЕСТНОГО РАЗМЕРА
+    // ========================================================================
+    std::cout << "\n3. copy из итератора ввода:" << std::endl;
+    CountingInputIterator first(0), last(static_cast<int>(count));
+    measure("std::copy + std::back_inserter", [&] {
+        std::vector<int> destination;
+        std::copy(first, last, std::back_inserter(destination));
+        return destination;
+    });
+    measure("copy + batch_back_inserter (буфер 1024)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination);
+        copy(first, last, mai::batch_back_inserter(batch));
+        batch.flush();
+        return destination;
+    });
+    measure("copy + batch_back_inserter (буфер 1024, ожидаемый размер)", [&] {
+        std::vector<int> destination;
+        mai::batch_inserter<std::vector<int>> batch(destination, count);
+        copy(first, last, mai::batch_back_inserter(batch));
+        batch.flush();
+        return destination;
+    });
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
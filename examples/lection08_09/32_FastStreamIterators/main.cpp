@@ -0,0 +1,114 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <filesystem>
+#include <cstdlib>
+
+#include "../06_IoStream/fast_stream_iterators.h"
+
+/**
+ * Измерение времени выполнения функции
+ *
+ * @param name - название варианта для вывода
+ * @param bytes - объем обработанных данных, для вывода скорости
+ * @param function - измеряемое действие, возвращает прочитанные числа
+ */
+template <typename Function>
+void measure(const char* name, size_t bytes, Function function) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<double> numbers = function();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    double seconds = std::max<double>(duration.count(), 1) / 1000.0;
+    std::cout << "   " << name << ": " << duration.count() << " мс, "
+              << static_cast<long long>(bytes / seconds / (1 << 20)) << " МБ/с"
+              << " (чисел " << numbers.size() << ", сумма " << std::accumulate(numbers.begin(), numbers.end(), 0.0) << ")"
+              << std::endl;
+}
+
+/**
+ * Основная функция - сравнение istream_iterator/ostream_iterator
+ * с parse_iterator/format_iterator
+ */
+int main(int argc, char** argv) {
+    size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+    size_t target_bytes = megabytes << 20;
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "fast_stream_iterators_numbers.txt";
+
+    std::cout << "=== РАЗБОР ЧИСЛОВОГО ФАЙЛА (" << megabytes << " МБ) ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ЗАПИСЬ - OSTREAM_ITERATOR ПРОТИВ FORMAT_ITERATOR
+    // ========================================================================
+    // Числа со случайными мантиссами: в кратчайшей записи около 18 символов
+    std::mt19937_64 generator(2024);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<double> sample(1'000'000);
+    for (double& value : sample) value = distribution(generator);
+
+    std::cout << "\n1. Запись " << sample.size() << " чисел:" << std::endl;
+    {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        std::ofstream output(path);
+        output.precision(17);
+        std::copy(sample.begin(), sample.end(), std::ostream_iterator<double>(output, "\n"));
+        output.close();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        std::cout << "   ostream_iterator (precision 17): "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count() << " мс" << std::endl;
+    }
+
+    size_t written_bytes = 0;
+    {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        std::ofstream output(path, std::ios::binary);
+        {
+            mai::output_buffer buffer(output);
+            std::copy(sample.begin(), sample.end(), mai::format_iterator<double>(buffer, "\n"));
+        }
+        written_bytes = static_cast<size_t>(output.tellp());
+        output.close();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        std::cout << "   format_iterator (to_chars):      "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count() << " мс" << std::endl;
+    }
+
+    // Файл нужного размера: тот же блок чисел записывается несколько раз
+    {
+        std::ofstream output(path, std::ios::binary);
+        mai::output_buffer buffer(output);
+        for (size_t written = 0; written < target_bytes; written += written_bytes)
+            std::copy(sample.begin(), sample.end(), mai::format_iterator<double>(buffer, "\n"));
+    }
+    size_t file_size = static_cast<size_t>(std::filesystem::file_size(path));
+    std::cout << "   Файл для разбора: " << path.string() << ", " << (file_size >> 20) << " МБ" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: РАЗБОР ФАЙЛА
+    // ========================================================================
+    std::cout << "\n2. Чтение всех чисел в std::vector<double>:" << std::endl;
+    measure("std::istream_iterator<double>", file_size, [&] {
+        std::ifstream input(path);
+        return std::vector<double>(std::istream_iterator<double>(input), std::istream_iterator<double>());
+    });
+    measure("mai::parse_iterator, блоки по 1 МБ", file_size, [&] {
+        std::ifstream input(path, std::ios::binary);
+        mai::input_buffer buffer(input);
+        return std::vector<double>(mai::parse_iterator<double>(buffer), mai::parse_iterator<double>());
+    });
+#ifdef FAST_STREAM_MMAP
+    measure("mai::parse_iterator, mmap", file_size, [&] {
+        mai::input_buffer buffer = mai::input_buffer::map_file(path.string());
+        return std::vector<double>(mai::parse_iterator<double>(buffer), mai::parse_iterator<double>());
+    });
+#endif
+
+    std::filesystem::remove(path);
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,548 @@
+#ifndef FLAT_CONTAINERS_H
+#define FLAT_CONTAINERS_H
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mai {
+
+    /**
+     * Метка "данные уже отсортированы и без повторов" - конструктор
+     * и insert не сортируют их повторно (как std::sorted_unique в C++23)
+     */
+    struct sorted_unique_t {
+        explicit sorted_unique_t() = default;
+    };
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    /**
+     * Метка "данные уже отсортированы" для flat_multiset
+     */
+    struct sorted_equivalent_t {
+        explicit sorted_equivalent_t() = default;
+    };
+    inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+    namespace detail {
+
+        struct identity_key {
+            template <class Value>
+            const Value& operator()(const Value& value) const noexcept { return value; }
+        };
+
+        struct first_key {
+            template <class Pair>
+            const auto& operator()(const Pair& value) const noexcept { return value.first; }
+        };
+
+        /**
+         * Упорядоченный контейнер поверх отсортированного std::vector
+         *
+         * std::set и std::map - красно-черные деревья: каждый элемент в своем
+         * узле, поиск и обход переходят по указателям между узлами, разбросанными
+         * по куче. Здесь элементы лежат подряд, поиск - двоичный по массиву,
+         * обход - последовательный проход по памяти.
+         *
+         * Цена - вставка и удаление одного элемента за O(n) (сдвиг хвоста),
+         * а также инвалидация итераторов при любом изменении. Поэтому элементы
+         * лучше добавлять пачками: конструктор из диапазона и insert_range
+         * сортируют новые элементы один раз и сливают их с имеющимися.
+         *
+         * @tparam Value - тип элемента
+         * @tparam Key - тип ключа
+         * @tparam KeyOfValue - извлечение ключа из элемента
+         * @tparam Compare - порядок ключей
+         * @tparam UNIQUE - запрещены ли элементы с равными ключами
+         */
+        template <class Value, class Key, class KeyOfValue, class Compare, bool UNIQUE>
+        class flat_tree {
+        public:
+            using key_type = Key;
+            using value_type = Value;
+            using key_compare = Compare;
+            using container_type = std::vector<Value>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using const_iterator = typename container_type::const_iterator;
+            // У множеств элементы - это ключи, менять их через итератор нельзя
+            using iterator = std::conditional_t<std::is_same_v<Value, Key>, const_iterator,
+                                                typename container_type::iterator>;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using insert_result = std::conditional_t<UNIQUE, std::pair<iterator, bool>, iterator>;
+            using sorted_tag = std::conditional_t<UNIQUE, sorted_unique_t, sorted_equivalent_t>;
+
+        protected:
+            container_type items;
+            [[no_unique_address]] Compare compare;
+
+            const Key& key_of(const Value& value) const { return KeyOfValue()(value); }
+
+            bool value_less(const Value& left, const Value& right) const {
+                return compare(key_of(left), key_of(right));
+            }
+
+            template <class K>
+            typename container_type::iterator lower_bound_of(const K& key) {
+                return std::lower_bound(items.begin(), items.end(), key,
+                                        [this](const Value& value, const K& searched) { return compare(key_of(value), searched); });
+            }
+
+            template <class K>
+            typename container_type::iterator upper_bound_of(typename container_type::iterator first, const K& key) {
+                return std::upper_bound(first, items.end(), key,
+                                        [this](const K& searched, const Value& value) { return compare(searched, key_of(value)); });
+            }
+
+            template <class K>
+            typename container_type::iterator find_of(const K& key) {
+                auto position = lower_bound_of(key);
+                if (position != items.end() && !compare(key, key_of(*position))) return position;
+                return items.end();
+            }
+
+            template <class K>
+            std::pair<iterator, iterator> equal_range_of(const K& key) {
+                auto first = lower_bound_of(key);
+                if constexpr (UNIQUE) {
+                    if (first != items.end() && !compare(key, key_of(*first))) return {first, first + 1};
+                    return {first, first};
+                } else {
+                    return {first, upper_bound_of(first, key)};
+                }
+            }
+
+            // Константные версии поиска не дублируются: поиск не меняет items
+            flat_tree& self() const noexcept { return const_cast<flat_tree&>(*this); }
+
+            /**
+             * Вставка одного элемента в позицию по порядку: O(log n) на поиск
+             * и O(n) на сдвиг хвоста. Равные элементы мультимножества
+             * добавляются после имеющихся, как в std::multiset
+             */
+            insert_result insert_value(value_type&& value) {
+                if constexpr (UNIQUE) {
+                    auto position = lower_bound_of(key_of(value));
+                    if (position != items.end() && !compare(key_of(value), key_of(*position))) return {position, false};
+                    return {items.insert(position, std::move(value)), true};
+                } else {
+                    return items.insert(upper_bound_of(items.begin(), key_of(value)), std::move(value));
+                }
+            }
+
+            /**
+             * Упорядочивание элементов, добавленных в конец массива после
+             * первых old_size: хвост сортируется, затем сливается с началом
+             * (std::inplace_merge) и, для уникальных ключей, очищается от
+             * повторов. Итого O(m log m + n) вместо m вставок по O(n).
+             *
+             * Сортировка и слияние устойчивые, а std::unique оставляет первый
+             * из равных элементов: при повторе ключа сохраняется уже
+             * имевшийся элемент, как при insert в std::set и std::map.
+             */
+            void merge_tail(size_type old_size, bool tail_sorted) {
+                auto middle = items.begin() + static_cast<difference_type>(old_size);
+                if (middle == items.end()) return;
+
+                auto by_key = [this](const Value& left, const Value& right) { return value_less(left, right); };
+                if (!tail_sorted) std::stable_sort(middle, items.end(), by_key);
+
+                // Старых элементов нет (построение из диапазона) - сливать не с чем
+                if (old_size == 0) {
+                    erase_repeats(items.begin());
+                    return;
+                }
+
+                // Новые элементы не меньше старых (добавление по возрастанию) - слияние не нужно
+                auto unique_from = items.begin();
+                if (value_less(*middle, *(middle - 1))) {
+                    std::inplace_merge(items.begin(), middle, items.end(), by_key);
+                } else {
+                    unique_from = middle - 1;
+                }
+                erase_repeats(unique_from);
+            }
+
+            /**
+             * Удаление повторов ключа в отсортированном отрезке [first, end())
+             * для уникальных ключей
+             */
+            void erase_repeats(typename container_type::iterator first) {
+                if constexpr (UNIQUE) {
+                    // В отсортированном массиве a <= b, и a ~ b равносильно !(a < b)
+                    auto unique_end = std::unique(first, items.end(),
+                                                  [this](const Value& left, const Value& right) { return !value_less(left, right); });
+                    items.erase(unique_end, items.end());
+                }
+            }
+
+            template <class InputIterator, class Sentinel>
+            void append(InputIterator first, Sentinel last) {
+                if constexpr (std::is_same_v<InputIterator, Sentinel>) {
+                    items.insert(items.end(), first, last);   // Для прямых итераторов - одно выделение
+                } else {
+                    for (; first != last; ++first) items.emplace_back(*first);
+                }
+            }
+
+        public:
+            flat_tree() = default;
+
+            explicit flat_tree(const Compare& key_order) : compare(key_order) {
+            }
+
+            /**
+             * Построение из неупорядоченного диапазона: копирование, одна
+             * сортировка и одно удаление повторов - O(n log n)
+             */
+            template <std::input_iterator InputIterator>
+            flat_tree(InputIterator first, InputIterator last, const Compare& key_order = Compare())
+                : items(first, last), compare(key_order) {
+                merge_tail(0, false);
+            }
+
+            flat_tree(std::initializer_list<value_type> values, const Compare& key_order = Compare())
+                : flat_tree(values.begin(), values.end(), key_order) {
+            }
+
+            /**
+             * Забирает готовый массив и упорядочивает его на месте
+             */
+            explicit flat_tree(container_type container, const Compare& key_order = Compare())
+                : items(std::move(container)), compare(key_order) {
+                merge_tail(0, false);
+            }
+
+            /**
+             * Массив уже отсортирован (и без повторов для уникальных ключей) -
+             * проверка не выполняется
+             */
+            flat_tree(sorted_tag, container_type container, const Compare& key_order = Compare())
+                : items(std::move(container)), compare(key_order) {
+            }
+
+            template <std::input_iterator InputIterator>
+            flat_tree(sorted_tag, InputIterator first, InputIterator last, const Compare& key_order = Compare())
+                : items(first, last), compare(key_order) {
+            }
+
+            // ========================================================================
+            // ИТЕРАТОРЫ И РАЗМЕР
+            // ========================================================================
+
+            iterator begin() noexcept { return items.begin(); }
+            iterator end() noexcept { return items.end(); }
+            const_iterator begin() const noexcept { return items.begin(); }
+            const_iterator end() const noexcept { return items.end(); }
+            const_iterator cbegin() const noexcept { return items.cbegin(); }
+            const_iterator cend() const noexcept { return items.cend(); }
+            reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+            reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+            const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+            const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+            bool empty() const noexcept { return items.empty(); }
+            size_type size() const noexcept { return items.size(); }
+            size_type max_size() const noexcept { return items.max_size(); }
+            size_type capacity() const noexcept { return items.capacity(); }
+            void reserve(size_type count) { items.reserve(count); }
+            void shrink_to_fit() { items.shrink_to_fit(); }
+            void clear() noexcept { items.clear(); }
+
+            key_compare key_comp() const { return compare; }
+
+            /**
+             * Отдать массив элементов (контейнер становится пустым)
+             */
+            container_type extract() && {
+                container_type result = std::move(items);
+                items.clear();
+                return result;
+            }
+
+            /**
+             * Заменить массив элементов уже упорядоченным массивом
+             */
+            void replace(container_type&& container) {
+                items = std::move(container);
+            }
+
+            // ========================================================================
+            // ВСТАВКА
+            // ========================================================================
+
+            insert_result insert(const value_type& value) { return insert_value(value_type(value)); }
+            insert_result insert(value_type&& value) { return insert_value(std::move(value)); }
+
+            template <class... Args>
+            insert_result emplace(Args&&... args) {
+                return insert_value(value_type(std::forward<Args>(args)...));
+            }
+
+            /**
+             * Вставка с подсказкой: если элемент встает прямо перед hint,
+             * двоичный поиск не нужен. Добавление по возрастанию с hint = end()
+             * обходится в O(1) амортизированно
+             */
+            iterator insert(const_iterator hint, value_type value) {
+                auto position = items.begin() + (hint - items.cbegin());
+                bool after_previous = position == items.begin() ||
+                                      (UNIQUE ? value_less(*(position - 1), value) : !value_less(value, *(position - 1)));
+                bool before_next = position == items.end() ||
+                                   (UNIQUE ? value_less(value, *position) : !value_less(*position, value));
+                if (after_previous && before_next) return items.insert(position, std::move(value));
+                if constexpr (UNIQUE) {
+                    return insert_value(std::move(value)).first;
+                } else {
+                    return insert_value(std::move(value));
+                }
+            }
+
+            template <class... Args>
+            iterator emplace_hint(const_iterator hint, Args&&... args) {
+                return insert(hint, value_type(std::forward<Args>(args)...));
+            }
+
+            /**
+             * Пакетная вставка диапазона: элементы добавляются в конец,
+             * хвост сортируется и сливается с имеющимися - O(m log m + n)
+             */
+            template <std::input_iterator InputIterator>
+            void insert(InputIterator first, InputIterator last) {
+                size_type old_size = items.size();
+                append(first, last);
+                merge_tail(old_size, false);
+            }
+
+            /**
+             * Диапазон уже упорядочен: остается только слияние - O(m + n)
+             */
+            template <std::input_iterator InputIterator>
+            void insert(sorted_tag, InputIterator first, InputIterator last) {
+                size_type old_size = items.size();
+                append(first, last);
+                merge_tail(old_size, true);
+            }
+
+            void insert(std::initializer_list<value_type> values) {
+                insert(values.begin(), values.end());
+            }
+
+            template <std::ranges::input_range Range>
+            void insert_range(Range&& range) {
+                size_type old_size = items.size();
+                if constexpr (std::ranges::sized_range<Range>) items.reserve(old_size + std::ranges::size(range));
+                append(std::ranges::begin(range), std::ranges::end(range));
+                merge_tail(old_size, false);
+            }
+
+            // ========================================================================
+            // УДАЛЕНИЕ
+            // ========================================================================
+
+            iterator erase(const_iterator position) { return items.erase(position); }
+            iterator erase(const_iterator first, const_iterator last) { return items.erase(first, last); }
+
+            size_type erase(const key_type& key) {
+                auto [first, last] = equal_range_of(key);
+                size_type removed = static_cast<size_type>(last - first);
+                items.erase(first, last);
+                return removed;
+            }
+
+            /**
+             * Удаление всех элементов, удовлетворяющих условию, за один проход
+             * (аналог std::erase_if для std::set)
+             */
+            template <class Predicate>
+            friend size_type erase_if(flat_tree& tree, Predicate predicate) {
+                return static_cast<size_type>(std::erase_if(tree.items, predicate));
+            }
+
+            void swap(flat_tree& other) noexcept {
+                using std::swap;
+                swap(items, other.items);
+                swap(compare, other.compare);
+            }
+
+            friend void swap(flat_tree& left, flat_tree& right) noexcept { left.swap(right); }
+
+            // ========================================================================
+            // ПОИСК
+            // ========================================================================
+            // Для прозрачного сравнения (std::less<>) ключ может быть любого
+            // сравнимого типа, например std::string_view для ключей std::string
+
+            iterator find(const key_type& key) { return find_of(key); }
+            const_iterator find(const key_type& key) const { return self().find_of(key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            iterator find(const K& key) { return find_of(key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            const_iterator find(const K& key) const { return self().find_of(key); }
+
+            bool contains(const key_type& key) const { return find(key) != end(); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            bool contains(const K& key) const { return find(key) != end(); }
+
+            size_type count(const key_type& key) const {
+                auto [first, last] = self().equal_range_of(key);
+                return static_cast<size_type>(last - first);
+            }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            size_type count(const K& key) const {
+                auto [first, last] = self().equal_range_of(key);
+                return static_cast<size_type>(last - first);
+            }
+
+            iterator lower_bound(const key_type& key) { return lower_bound_of(key); }
+            const_iterator lower_bound(const key_type& key) const { return self().lower_bound_of(key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            iterator lower_bound(const K& key) { return lower_bound_of(key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            const_iterator lower_bound(const K& key) const { return self().lower_bound_of(key); }
+
+            iterator upper_bound(const key_type& key) { return upper_bound_of(items.begin(), key); }
+            const_iterator upper_bound(const key_type& key) const { return self().upper_bound_of(self().items.begin(), key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            iterator upper_bound(const K& key) { return upper_bound_of(items.begin(), key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            const_iterator upper_bound(const K& key) const { return self().upper_bound_of(self().items.begin(), key); }
+
+            std::pair<iterator, iterator> equal_range(const key_type& key) { return equal_range_of(key); }
+
+            std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+                auto [first, last] = self().equal_range_of(key);
+                return {first, last};
+            }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            std::pair<iterator, iterator> equal_range(const K& key) { return equal_range_of(key); }
+
+            template <class K> requires requires { typename Compare::is_transparent; }
+            std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+                auto [first, last] = self().equal_range_of(key);
+                return {first, last};
+            }
+
+            // ========================================================================
+            // СРАВНЕНИЕ
+            // ========================================================================
+
+            friend bool operator==(const flat_tree& left, const flat_tree& right) {
+                return left.items == right.items;
+            }
+
+            friend auto operator<=>(const flat_tree& left, const flat_tree& right)
+                requires std::three_way_comparable<value_type> {
+                return std::lexicographical_compare_three_way(left.items.begin(), left.items.end(),
+                                                              right.items.begin(), right.items.end());
+            }
+        };
+    }
+
+    /**
+     * Множество уникальных ключей на отсортированном массиве - замена std::set
+     */
+    template <class Key, class Compare = std::less<Key>>
+    using flat_set = detail::flat_tree<Key, Key, detail::identity_key, Compare, true>;
+
+    /**
+     * Множество с повторами на отсортированном массиве - замена std::multiset
+     */
+    template <class Key, class Compare = std::less<Key>>
+    using flat_multiset = detail::flat_tree<Key, Key, detail::identity_key, Compare, false>;
+
+    /**
+     * Словарь на отсортированном массиве пар - замена std::map
+     *
+     * Отличие от std::map: элементы хранятся как std::pair<Key, T>, а не
+     * std::pair<const Key, T> - иначе массив нельзя было бы сортировать.
+     * Менять first через итератор нельзя: это нарушит порядок.
+     */
+    template <class Key, class T, class Compare = std::less<Key>>
+    class flat_map : public detail::flat_tree<std::pair<Key, T>, Key, detail::first_key, Compare, true> {
+    private:
+        using base = detail::flat_tree<std::pair<Key, T>, Key, detail::first_key, Compare, true>;
+
+    public:
+        using mapped_type = T;
+        using typename base::iterator;
+        using typename base::key_type;
+        using typename base::value_type;
+
+        using base::base;
+
+    private:
+        template <class K, class... Args>
+        std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args) {
+            auto position = this->lower_bound_of(key);
+            if (position != this->items.end() && !this->compare(key, position->first)) return {position, false};
+            position = this->items.emplace(position, std::piecewise_construct,
+                                           std::forward_as_tuple(std::forward<K>(key)),
+                                           std::forward_as_tuple(std::forward<Args>(args)...));
+            return {position, true};
+        }
+
+    public:
+        /**
+         * Вставка элемента, если ключа еще нет. Значение создается из args
+         * только при вставке
+         */
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            return try_emplace_key(key, std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& object) {
+            auto result = try_emplace_key(key, std::forward<M>(object));
+            if (!result.second) result.first->second = std::forward<M>(object);
+            return result;
+        }
+
+        T& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        T& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+        /**
+         * @throws std::out_of_range если ключа нет
+         */
+        T& at(const key_type& key) {
+            auto position = this->find(key);
+            if (position == this->end()) throw std::out_of_range("flat_map::at: ключ не найден");
+            return position->second;
+        }
+
+        const T& at(const key_type& key) const {
+            auto position = this->find(key);
+            if (position == this->end()) throw std::out_of_range("flat_map::at: ключ не найден");
+            return position->second;
+        }
+    };
+}
+
+#endif // FLAT_CONTAINERS_H
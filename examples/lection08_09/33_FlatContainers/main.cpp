@@ -0,0 +1,249 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <set>
+#include <map>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdlib>
+#include <algorithm>
+
+#include "flat_containers.h"
+
+/**
+ * Время одного действия в наносекундах на операцию
+ * Действие повторяется repeats раз, берется лучший из трех замеров
+ *
+ * @param operations - число операций в одном выполнении action
+ * @param checksum - сюда добавляется контрольное значение, чтобы
+ *                   компилятор не выбросил вычисления
+ */
+template <class Action>
+double nanosecondsPerOperation(size_t operations, size_t repeats, long long& checksum, Action action) {
+    double best = -1;
+    for (int run_index = 0; run_index < 3; ++run_index) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        for (size_t repeat_index = 0; repeat_index < repeats; ++repeat_index) checksum += action();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        double elapsed = std::chrono::duration<double, std::nano>(end_time - start_time).count();
+        double per_operation = elapsed / static_cast<double>(operations * repeats);
+        if (best < 0 || per_operation < best) best = per_operation;
+    }
+    return best;
+}
+
+/**
+ * Текст, дополненный пробелами до width символов. std::setw считает байты,
+ * а буква кириллицы в UTF-8 занимает два байта
+ */
+std::string padded(const std::string& text, size_t width, bool align_right = false) {
+    size_t symbols = 0;
+    for (unsigned char byte : text) symbols += (byte & 0xC0) != 0x80;
+    std::string padding(width > symbols ? width - symbols : 0, ' ');
+    return align_right ? padding + text : text + padding;
+}
+
+/**
+ * Строка таблицы: операция, время std-контейнера, время flat-контейнера и ускорение
+ */
+void printRow(const char* operation, double tree_time, double flat_time) {
+    std::cout << "      " << padded(operation, 24) << std::fixed << std::setprecision(1)
+              << std::setw(10) << tree_time << std::setw(10) << flat_time
+              << std::setw(11) << tree_time / flat_time << "x" << std::endl;
+}
+
+/**
+ * Сравнение std::set/std::map с flat_set/flat_map на size элементах
+ *
+ * - построение: std::set - вставка по одному, flat_set - конструктор из
+ *   неупорядоченного диапазона (одна сортировка);
+ * - поиск: миллион случайных ключей, примерно половина есть в контейнере;
+ * - обход: сумма всех элементов;
+ * - пакетная вставка: еще size / 10 случайных ключей, insert по одному
+ *   против insert_range.
+ */
+void compareContainers(size_t size, long long& checksum) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(2 * size));
+    std::vector<int> keys(size);
+    for (auto& key : keys) key = distribution(generator);
+    std::vector<int> lookups(1'000'000);
+    for (auto& key : lookups) key = distribution(generator);
+    std::vector<int> extra(std::max<size_t>(size / 10, 1));
+    for (auto& key : extra) key = distribution(generator);
+
+    size_t build_repeats = std::max<size_t>(1, 1'000'000 / size);
+    size_t pass_repeats = std::max<size_t>(1, 10'000'000 / size);
+
+    std::cout << "\n   " << size << " элементов (нс на операцию):" << std::endl;
+    std::cout << "      " << padded("операция", 24) << padded("std", 10, true) << padded("flat", 10, true)
+              << padded("ускорение", 12, true) << std::endl;
+
+    // ========================================================================
+    // std::set ПРОТИВ flat_set
+    // ========================================================================
+    {
+        double tree_build = nanosecondsPerOperation(size, build_repeats, checksum, [&] {
+            std::set<int> tree(keys.begin(), keys.end());
+            return static_cast<long long>(tree.size());
+        });
+        double flat_build = nanosecondsPerOperation(size, build_repeats, checksum, [&] {
+            mai::flat_set<int> flat(keys.begin(), keys.end());
+            return static_cast<long long>(flat.size());
+        });
+        printRow("set: построение", tree_build, flat_build);
+
+        std::set<int> tree(keys.begin(), keys.end());
+        mai::flat_set<int> flat(keys.begin(), keys.end());
+
+        double tree_find = nanosecondsPerOperation(lookups.size(), 1, checksum, [&] {
+            long long found = 0;
+            for (int key : lookups) found += tree.find(key) != tree.end();
+            return found;
+        });
+        double flat_find = nanosecondsPerOperation(lookups.size(), 1, checksum, [&] {
+            long long found = 0;
+            for (int key : lookups) found += flat.find(key) != flat.end();
+            return found;
+        });
+        printRow("set: find", tree_find, flat_find);
+
+        double tree_pass = nanosecondsPerOperation(tree.size(), pass_repeats, checksum, [&] {
+            long long sum = 0;
+            for (int key : tree) sum += key;
+            return sum;
+        });
+        double flat_pass = nanosecondsPerOperation(flat.size(), pass_repeats, checksum, [&] {
+            long long sum = 0;
+            for (int key : flat) sum += key;
+            return sum;
+        });
+        printRow("set: обход", tree_pass, flat_pass);
+
+        double tree_insert = nanosecondsPerOperation(extra.size(), 1, checksum, [&] {
+            std::set<int> copy = tree;
+            for (int key : extra) copy.insert(key);
+            return static_cast<long long>(copy.size());
+        });
+        double flat_insert = nanosecondsPerOperation(extra.size(), 1, checksum, [&] {
+            mai::flat_set<int> copy = flat;
+            copy.insert_range(extra);
+            return static_cast<long long>(copy.size());
+        });
+        printRow("set: +10% (с копией)", tree_insert, flat_insert);
+    }
+
+    // ========================================================================
+    // std::map ПРОТИВ flat_map
+    // ========================================================================
+    {
+        std::map<int, int> tree;
+        for (int key : keys) tree.emplace(key, key / 2);
+        std::vector<std::pair<int, int>> pairs;
+        pairs.reserve(keys.size());
+        for (int key : keys) pairs.emplace_back(key, key / 2);
+        mai::flat_map<int, int> flat(pairs.begin(), pairs.end());
+
+        double tree_find = nanosecondsPerOperation(lookups.size(), 1, checksum, [&] {
+            long long sum = 0;
+            for (int key : lookups) {
+                auto position = tree.find(key);
+                if (position != tree.end()) sum += position->second;
+            }
+            return sum;
+        });
+        double flat_find = nanosecondsPerOperation(lookups.size(), 1, checksum, [&] {
+            long long sum = 0;
+            for (int key : lookups) {
+                auto position = flat.find(key);
+                if (position != flat.end()) sum += position->second;
+            }
+            return sum;
+        });
+        printRow("map: find", tree_find, flat_find);
+
+        double tree_pass = nanosecondsPerOperation(tree.size(), pass_repeats, checksum, [&] {
+            long long sum = 0;
+            for (const auto& [key, value] : tree) sum += value;
+            return sum;
+        });
+        double flat_pass = nanosecondsPerOperation(flat.size(), pass_repeats, checksum, [&] {
+            long long sum = 0;
+            for (const auto& [key, value] : flat) sum += value;
+            return sum;
+        });
+        printRow("map: обход", tree_pass, flat_pass);
+    }
+}
+
+/**
+ * Основная функция - интерфейс flat-контейнеров и сравнение с деревьями
+ */
+int main(int argc, char* argv[]) {
+    size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::cout << "=== FLAT_SET, FLAT_MAP, FLAT_MULTISET ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ТОТ ЖЕ ИНТЕРФЕЙС, ЧТО У STD::SET (СМ. 14_Set)
+    // ========================================================================
+    std::cout << "\n1. flat_set:" << std::endl;
+    {
+        mai::flat_set<int> integer_set;
+        auto insertion_result = integer_set.insert(42);
+        std::cout << "   insert(42): вставлен " << (insertion_result.second ? "ДА" : "НЕТ") << std::endl;
+        insertion_result = integer_set.insert(42);
+        std::cout << "   insert(42): вставлен " << (insertion_result.second ? "ДА" : "НЕТ") << std::endl;
+
+        // Неупорядоченный диапазон с повторами: одна сортировка и одно удаление повторов
+        std::vector<int> unsorted = {5, 3, 9, 3, 1, 5, 7};
+        mai::flat_set<int> bulk_set(unsorted.begin(), unsorted.end());
+        bulk_set.insert_range(std::vector<int>{8, 2, 9, 4});
+        std::cout << "   Из {5 3 9 3 1 5 7} + insert_range{8 2 9 4}: ";
+        for (int element : bulk_set) std::cout << element << ' ';
+        std::cout << std::endl;
+        std::cout << "   lower_bound(6) = " << *bulk_set.lower_bound(6)
+                  << ", contains(6) = " << std::boolalpha << bulk_set.contains(6) << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: FLAT_MULTISET (СМ. 16_Multiset)
+    // ========================================================================
+    std::cout << "\n2. flat_multiset:" << std::endl;
+    {
+        mai::flat_multiset<int> integer_multiset = {42, 7, 42};
+        integer_multiset.insert(42);
+        std::cout << "   count(42) = " << integer_multiset.count(42)
+                  << ", erase(42) удалил " << integer_multiset.erase(42)
+                  << ", осталось " << integer_multiset.size() << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: FLAT_MAP (СМ. 15_Map)
+    // ========================================================================
+    std::cout << "\n3. flat_map:" << std::endl;
+    {
+        mai::flat_map<std::string, int, std::less<>> word_number_map = {{"Charlie", 3}, {"Alpha", 1}, {"Bravo", 2}};
+        word_number_map["Delta"] = 4;
+        auto insertion_result = word_number_map.insert({"Alpha", 100});
+        std::cout << "   insert(Alpha, 100): вставлен " << (insertion_result.second ? "ДА" : "НЕТ")
+                  << ", значение " << word_number_map.at("Alpha") << std::endl;
+        // std::less<> - поиск по const char* без создания std::string
+        std::cout << "   find(\"Bravo\")->second = " << word_number_map.find("Bravo")->second << std::endl;
+        std::cout << "   ";
+        for (const auto& [key, value] : word_number_map) std::cout << key << '=' << value << ' ';
+        std::cout << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 4: ПРОИЗВОДИТЕЛЬНОСТЬ
+    // ========================================================================
+    std::cout << "\n4. Сравнение с std::set и std::map:" << std::endl;
+    long long checksum = 0;
+    for (size_t size = 1000; size <= max_size; size *= 10) compareContainers(size, checksum);
+    std::cout << "\n   контрольная сумма " << checksum << std::endl;
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <unordered_set>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "swiss_table.h"
+
+/**
+ * Прозрачный хеш строк: поиск по std::string_view и const char*
+ * без создания временной std::string
+ */
+struct string_hash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view text) const noexcept {
+        return std::hash<std::string_view>()(text);
+    }
+};
+
+/**
+ * Текст, дополненный пробелами до width символов. std::setw считает байты,
+ * а буква кириллицы в UTF-8 занимает два байта
+ */
+std::string padded(const std::string& text, size_t width, bool align_right = false) {
+    size_t symbols = 0;
+    for (unsigned char byte : text) symbols += (byte & 0xC0) != 0x80;
+    std::string padding(width > symbols ? width - symbols : 0, ' ');
+    return align_right ? padding + text : text + padding;
+}
+
+/**
+ * Время в наносекундах на операцию
+ *
+ * @param operations - число операций в action
+ * @param checksum - сюда добавляется контрольное значение, чтобы
+ *                   компилятор не выбросил вычисления
+ */
+template <class Action>
+double nanosecondsPerOperation(size_t operations, long long& checksum, Action action) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    checksum += action();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end_time - start_time).count() / static_cast<double>(operations);
+}
+
+/**
+ * Замеры одного контейнера: вставка, успешный и неудачный поиск, удаление
+ */
+struct Timings {
+    double insert = 0;
+    double reserved_insert = 0;
+    double found = 0;
+    double missing = 0;
+    double erase = 0;
+
+    void keepBest(const Timings& other) {
+        auto best = [](double current, double candidate) { return current == 0 || candidate < current ? candidate : current; };
+        insert = best(insert, other.insert);
+        reserved_insert = best(reserved_insert, other.reserved_insert);
+        found = best(found, other.found);
+        missing = best(missing, other.missing);
+        erase = best(erase, other.erase);
+    }
+};
+
+/**
+ * Прогон всех операций на контейнере Set
+ *
+ * @param keys - вставляемые ключи
+ * @param shuffled_keys - те же ключи в другом порядке (поиск и удаление)
+ * @param missing_keys - ключи, которых в контейнере нет
+ */
+template <class Set>
+Timings measureSet(const std::vector<uint64_t>& keys, const std::vector<uint64_t>& shuffled_keys,
+                   const std::vector<uint64_t>& missing_keys, long long& checksum) {
+    Timings timings;
+    size_t count = keys.size();
+    {
+        Set growing;
+        timings.insert = nanosecondsPerOperation(count, checksum, [&] {
+            for (uint64_t key : keys) growing.insert(key);
+            return static_cast<long long>(growing.size());
+        });
+    }
+
+    Set table;
+    timings.reserved_insert = nanosecondsPerOperation(count, checksum, [&] {
+        table.reserve(count);
+        for (uint64_t key : keys) table.insert(key);
+        return static_cast<long long>(table.size());
+    });
+    timings.found = nanosecondsPerOperation(count, checksum, [&] {
+        long long found = 0;
+        for (uint64_t key : shuffled_keys) found += table.count(key);
+        return found;
+    });
+    timings.missing = nanosecondsPerOperation(count, checksum, [&] {
+        long long found = 0;
+        for (uint64_t key : missing_keys) found += table.count(key);
+        return found;
+    });
+    timings.erase = nanosecondsPerOperation(count, checksum, [&] {
+        long long erased = 0;
+        for (uint64_t key : shuffled_keys) erased += static_cast<long long>(table.erase(key));
+        return erased;
+    });
+    return timings;
+}
+
+void printRow(const char* operation, double standard_time, double swiss_time) {
+    std::cout << "      " << padded(operation, 26) << std::fixed << std::setprecision(1)
+              << std::setw(10) << standard_time << std::setw(10) << swiss_time
+              << std::setw(11) << standard_time / swiss_time << "x" << std::endl;
+}
+
+/**
+ * Сравнение std::unordered_set<uint64_t> и mai::swiss_set<uint64_t> на count ключах
+ */
+void compareSets(size_t count, long long& checksum) {
+    // Умножение на нечетную константу - биекция на uint64_t: ключи различны
+    constexpr uint64_t SPREAD = 0x9E3779B97F4A7C15ULL;
+    std::vector<uint64_t> keys(count);
+    std::vector<uint64_t> missing_keys(count);
+    for (size_t index = 0; index < count; ++index) {
+        keys[index] = (index + 1) * SPREAD;
+        missing_keys[index] = (index + 1 + count) * SPREAD;
+    }
+    std::vector<uint64_t> shuffled_keys = keys;
+    std::shuffle(shuffled_keys.begin(), shuffled_keys.end(), std::mt19937_64(42));
+
+    // Маленькие размеры - лучший из трех прогонов, большие - один
+    int runs = count <= 1'000'000 ? 3 : 1;
+    Timings standard;
+    Timings swiss;
+    for (int run_index = 0; run_index < runs; ++run_index) {
+        standard.keepBest(measureSet<std::unordered_set<uint64_t>>(keys, shuffled_keys, missing_keys, checksum));
+        swiss.keepBest(measureSet<mai::swiss_set<uint64_t>>(keys, shuffled_keys, missing_keys, checksum));
+    }
+
+    std::cout << "\n   " << count << " ключей (нс на операцию):" << std::endl;
+    std::cout << "      " << padded("операция", 26) << padded("std", 10, true) << padded("swiss", 10, true)
+              << padded("ускорение", 12, true) << std::endl;
+    printRow("insert", standard.insert, swiss.insert);
+    printRow("reserve + insert", standard.reserved_insert, swiss.reserved_insert);
+    printRow("поиск: ключ есть", standard.found, swiss.found);
+    printRow("поиск: ключа нет", standard.missing, swiss.missing);
+    printRow("erase", standard.erase, swiss.erase);
+}
+
+/**
+ * Основная функция - интерфейс swiss_set/swiss_map и сравнение с std::unordered_set
+ */
+int main(int argc, char* argv[]) {
+    size_t max_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::cout << "=== SWISS_SET И SWISS_MAP: ОТКРЫТАЯ АДРЕСАЦИЯ ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: ТОТ ЖЕ ИНТЕРФЕЙС, ЧТО У STD::UNORDERED_SET (СМ. 17_UnorderedSet)
+    // ========================================================================
+    std::cout << "\n1. swiss_set:" << std::endl;
+    {
+        mai::swiss_set<int> integer_hash_set;
+        auto insertion_result = integer_hash_set.insert(42);
+        std::cout << "   insert(42): вставлен " << (insertion_result.second ? "ДА" : "НЕТ") << std::endl;
+        insertion_result = integer_hash_set.insert(42);
+        std::cout << "   insert(42): вставлен " << (insertion_result.second ? "ДА" : "НЕТ") << std::endl;
+
+        for (int element_value = 0; element_value < 100; ++element_value) integer_hash_set.insert(element_value);
+        std::cout << "   size = " << integer_hash_set.size() << ", capacity = " << integer_hash_set.capacity()
+                  << ", load_factor = " << integer_hash_set.load_factor() << std::endl;
+
+        mai::swiss_set<int> reserved_set;
+        reserved_set.reserve(100);
+        size_t reserved_capacity = reserved_set.capacity();
+        for (int element_value = 0; element_value < 100; ++element_value) reserved_set.insert(element_value);
+        std::cout << "   reserve(100): capacity " << reserved_capacity << " -> " << reserved_set.capacity()
+                  << " (без перехеширования)" << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: SWISS_MAP И ПОИСК ПО STRING_VIEW
+    // ========================================================================
+    std::cout << "\n2. swiss_map с прозрачным хешем:" << std::endl;
+    {
+        mai::swiss_map<std::string, int, string_hash, std::equal_to<>> word_count;
+        for (std::string_view word : {"alpha", "bravo", "alpha", "charlie", "alpha"}) ++word_count[std::string(word)];
+        std::string_view searched = "alpha";
+        std::cout << "   find(string_view \"alpha\")->second = " << word_count.find(searched)->second << std::endl;
+        std::cout << "   contains(\"delta\") = " << std::boolalpha << word_count.contains("delta") << std::endl;
+        word_count.erase("bravo");
+        std::cout << "   после erase(\"bravo\"): size = " << word_count.size() << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ПРОИЗВОДИТЕЛЬНОСТЬ
+    // ========================================================================
+    std::cout << "\n3. Сравнение с std::unordered_set<uint64_t>:" << std::endl;
+    long long checksum = 0;
+    for (size_t count = 1'000'000; count <= max_count; count *= 10) compareSets(count, checksum);
+    std::cout << "\n   контрольная сумма " << checksum << std::endl;
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,672 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace mai {
+
+    namespace detail {
+
+        /**
+         * Управляющий байт ячейки таблицы:
+         * - 0..127 - ячейка занята, в байте 7 младших бит хеша (H2);
+         * - empty - ячейка свободна, поиск на ней останавливается;
+         * - deleted - элемент удален ("надгробие"), поиск идет дальше
+         */
+        enum control_byte : int8_t {
+            control_empty = -128,     // 0b10000000
+            control_deleted = -2,     // 0b11111110
+        };
+
+        /**
+         * Набор ячеек группы, найденных сравнением управляющих байтов
+         * Одна ячейка - один бит (SSE2) или старший бит байта (SHIFT = 3)
+         */
+        template <class Bits, int WIDTH, int SHIFT>
+        class bit_mask {
+        private:
+            Bits bits;
+
+        public:
+            explicit bit_mask(Bits mask_bits) : bits(mask_bits) {
+            }
+
+            explicit operator bool() const noexcept { return bits != 0; }
+
+            int lowest() const noexcept { return std::countr_zero(bits) >> SHIFT; }
+
+            /** Число подряд идущих невыбранных ячеек с начала группы */
+            int trailing_zeros() const noexcept { return bits == 0 ? WIDTH : std::countr_zero(bits) >> SHIFT; }
+
+            /** Число подряд идущих невыбранных ячеек с конца группы */
+            int leading_zeros() const noexcept {
+                if (bits == 0) return WIDTH;
+                return (std::countl_zero(bits) - (static_cast<int>(sizeof(Bits)) * 8 - WIDTH * (1 << SHIFT))) >> SHIFT;
+            }
+
+            void clear_lowest() noexcept { bits &= static_cast<Bits>(bits - 1); }
+        };
+
+#ifdef SWISS_TABLE_SSE2
+        /**
+         * Группа из 16 управляющих байтов: одно сравнение SSE2 проверяет
+         * сразу 16 ячеек, _mm_movemask_epi8 собирает результат в 16 бит
+         */
+        class control_group {
+        public:
+            static constexpr int WIDTH = 16;
+            using mask = bit_mask<uint16_t, WIDTH, 0>;
+
+        private:
+            __m128i control;
+
+            static mask to_mask(__m128i compared) {
+                return mask(static_cast<uint16_t>(_mm_movemask_epi8(compared)));
+            }
+
+        public:
+            explicit control_group(const int8_t* position)
+                : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position))) {
+            }
+
+            mask match(int8_t hash_bits) const { return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(hash_bits), control)); }
+            mask match_empty() const { return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(control_empty), control)); }
+            // У empty и deleted старший бит установлен, у занятых - нет
+            mask match_empty_or_deleted() const { return to_mask(control); }
+        };
+#else
+        /**
+         * Переносимая группа из 8 управляющих байтов в uint64_t (SWAR -
+         * "SIMD внутри регистра"): сравнения делаются арифметикой над словом
+         */
+        class control_group {
+        public:
+            static constexpr int WIDTH = 8;
+            using mask = bit_mask<uint64_t, WIDTH, 3>;
+
+        private:
+            static constexpr uint64_t LOW_BITS = 0x0101010101010101ULL;
+            static constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+            static_assert(std::endian::native == std::endian::little, "порядок байтов группы рассчитан на little-endian");
+
+            uint64_t control;
+
+        public:
+            explicit control_group(const int8_t* position) {
+                std::memcpy(&control, position, sizeof(control));
+            }
+
+            // Может дать ложное совпадение - оно отсеивается сравнением ключей
+            mask match(int8_t hash_bits) const {
+                uint64_t difference = control ^ (LOW_BITS * static_cast<uint8_t>(hash_bits));
+                return mask((difference - LOW_BITS) & ~difference & HIGH_BITS);
+            }
+
+            // empty = 0b10000000: старший бит есть, бит 1 - нет
+            mask match_empty() const { return mask(control & ~(control << 6) & HIGH_BITS); }
+            mask match_empty_or_deleted() const { return mask(control & HIGH_BITS); }
+        };
+#endif
+
+        /**
+         * Перемешивание хеша. std::hash<int> - тождественная функция, и без
+         * перемешивания последовательные ключи давали бы одинаковые H2
+         * (финализатор MurmurHash3)
+         */
+        inline uint64_t mix_hash(uint64_t hash) noexcept {
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdULL;
+            hash ^= hash >> 33;
+            hash *= 0xc4ceb9fe1a85ec53ULL;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        struct swiss_set_key {
+            template <class Value>
+            const Value& operator()(const Value& value) const noexcept { return value; }
+        };
+
+        struct swiss_map_key {
+            template <class Pair>
+            const auto& operator()(const Pair& value) const noexcept { return value.first; }
+        };
+
+        /**
+         * Хеш-таблица с открытой адресацией в стиле Swiss Table
+         *
+         * std::unordered_set хранит каждый элемент в отдельном узле, а корзины -
+         * это списки узлов: вставка выделяет память, поиск идет по указателям.
+         * Здесь элементы лежат прямо в массиве ячеек, а рядом - массив
+         * управляющих байтов, по байту на ячейку. Поиск сравнивает 7 бит хеша
+         * сразу с группой из 16 байтов (одна инструкция SSE2) и сравнивает
+         * ключи только у совпавших ячеек - обычно у одной.
+         *
+         * Ячейки просматриваются группами, начиная с позиции H1 (старшие биты
+         * хеша); следующая группа - через 1, 2, 3... групп (треугольные
+         * числа обходят весь массив). Поиск останавливается на группе, где
+         * есть пустая ячейка. Заполнение - не больше 7/8 емкости.
+         *
+         * Адреса элементов не меняются до перехеширования: erase оставляет
+         * остальные итераторы действительными, insert - пока не нужен рост.
+         *
+         * @tparam Value - тип элемента
+         * @tparam Key - тип ключа
+         * @tparam KeyOfValue - извлечение ключа из элемента
+         * @tparam Hash, KeyEqual - хеш и сравнение ключей, как у std::unordered_set
+         */
+        template <class Value, class Key, class KeyOfValue, class Hash, class KeyEqual>
+        class swiss_table {
+        private:
+            using group = control_group;
+            static constexpr size_t WIDTH = group::WIDTH;
+            static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+            template <class Element>
+            class basic_iterator {
+            private:
+                friend class swiss_table;
+
+                const int8_t* control = nullptr;
+                Value* slot = nullptr;
+                const int8_t* control_end = nullptr;
+
+                void skip_free() {
+                    while (control != control_end && *control < 0) {
+                        ++control;
+                        ++slot;
+                    }
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Value;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Element*;
+                using reference = Element&;
+
+                basic_iterator() = default;
+
+                basic_iterator(const int8_t* position, Value* slot_pointer, const int8_t* end_position)
+                    : control(position), slot(slot_pointer), control_end(end_position) {
+                }
+
+                // iterator -> const_iterator
+                operator basic_iterator<const Value>() const { return {control, slot, control_end}; }
+
+                reference operator*() const { return *slot; }
+                pointer operator->() const { return slot; }
+
+                basic_iterator& operator++() {
+                    ++control;
+                    ++slot;
+                    skip_free();
+                    return *this;
+                }
+
+                basic_iterator operator++(int) {
+                    basic_iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                bool operator==(const basic_iterator& other) const { return control == other.control; }
+            };
+
+        public:
+            using key_type = Key;
+            using value_type = Value;
+            using hasher = Hash;
+            using key_equal = KeyEqual;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using const_iterator = basic_iterator<const Value>;
+            // У множеств элементы - это ключи, менять их через итератор нельзя
+            using iterator = std::conditional_t<std::is_same_v<Value, Key>, const_iterator, basic_iterator<Value>>;
+
+        protected:
+            int8_t* controls = nullptr;    // capacity + WIDTH байтов: хвост повторяет первые WIDTH
+            Value* slots = nullptr;
+            size_t capacity_value = 0;     // Степень двойки (или 0 у пустой таблицы)
+            size_t size_value = 0;
+            size_t growth_left = 0;        // Сколько еще пустых ячеек можно занять до роста
+            [[no_unique_address]] Hash hash_function;
+            [[no_unique_address]] KeyEqual equal_function;
+
+            static constexpr bool TRANSPARENT = requires {
+                typename Hash::is_transparent;
+                typename KeyEqual::is_transparent;
+            };
+
+            // Ключ другого типа, но не итератор: иначе шаблон erase(const K&) точнее
+            // подходит для erase(find(key)), чем erase(const_iterator), как и в std
+            template <class K>
+            static constexpr bool HETEROGENEOUS = TRANSPARENT && !std::is_convertible_v<K, iterator> &&
+                                                  !std::is_convertible_v<K, const_iterator>;
+
+            const Key& key_of(const Value& value) const { return KeyOfValue()(value); }
+
+            template <class K>
+            uint64_t hash_of(const K& key) const { return mix_hash(static_cast<uint64_t>(hash_function(key))); }
+
+            static int8_t low_bits(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }       // H2
+            size_t start_position(uint64_t hash) const { return (hash >> 7) & (capacity_value - 1); } // H1
+
+            /** Емкость с запасом до заполнения 7/8 */
+            static size_t max_load(size_t capacity) { return capacity - capacity / 8; }
+
+            /**
+             * Запись управляющего байта. Первые WIDTH байтов продублированы
+             * после конца массива, чтобы группу можно было прочитать с любой
+             * позиции без переноса через начало
+             */
+            void set_control(size_t index, int8_t value) {
+                controls[index] = value;
+                if (index < WIDTH) controls[capacity_value + index] = value;
+            }
+
+            template <class K>
+            size_t find_index(const K& key, uint64_t hash) const {
+                if (capacity_value == 0) return NOT_FOUND;
+                size_t mask = capacity_value - 1;
+                size_t position = start_position(hash);
+                for (size_t step = WIDTH;; step += WIDTH) {
+                    group current(controls + position);
+                    for (auto matches = current.match(low_bits(hash)); matches; matches.clear_lowest()) {
+                        size_t index = (position + static_cast<size_t>(matches.lowest())) & mask;
+                        if (equal_function(key_of(slots[index]), key)) return index;
+                    }
+                    if (current.match_empty()) return NOT_FOUND;
+                    position = (position + step) & mask;
+                }
+            }
+
+            /** Первая свободная (пустая или удаленная) ячейка на пути поиска */
+            size_t find_free_index(uint64_t hash) const {
+                size_t mask = capacity_value - 1;
+                size_t position = start_position(hash);
+                for (size_t step = WIDTH;; step += WIDTH) {
+                    auto free_slots = group(controls + position).match_empty_or_deleted();
+                    if (free_slots) return (position + static_cast<size_t>(free_slots.lowest())) & mask;
+                    position = (position + step) & mask;
+                }
+            }
+
+            /**
+             * Перенос всех элементов в массив новой емкости. Удаленные
+             * ячейки при этом исчезают
+             */
+            void rehash_to(size_t new_capacity) {
+                int8_t* old_controls = controls;
+                Value* old_slots = slots;
+                size_t old_capacity = capacity_value;
+
+                controls = std::allocator<int8_t>().allocate(new_capacity + WIDTH);
+                try {
+                    slots = std::allocator<Value>().allocate(new_capacity);
+                } catch (...) {
+                    std::allocator<int8_t>().deallocate(controls, new_capacity + WIDTH);
+                    controls = old_controls;
+                    throw;
+                }
+                std::memset(controls, static_cast<uint8_t>(control_empty), new_capacity + WIDTH);
+                capacity_value = new_capacity;
+                growth_left = max_load(new_capacity) - size_value;
+
+                for (size_t index = 0; index < old_capacity; ++index) {
+                    if (old_controls[index] < 0) continue;
+                    uint64_t hash = hash_of(key_of(old_slots[index]));
+                    size_t target = find_free_index(hash);
+                    ::new (static_cast<void*>(slots + target)) Value(std::move_if_noexcept(old_slots[index]));
+                    set_control(target, low_bits(hash));
+                    std::destroy_at(old_slots + index);
+                }
+                if (old_capacity > 0) {
+                    std::allocator<int8_t>().deallocate(old_controls, old_capacity + WIDTH);
+                    std::allocator<Value>().deallocate(old_slots, old_capacity);
+                }
+            }
+
+            /**
+             * Места под новый элемент нет. Если больше половины занятого -
+             * удаленные ячейки, таблица пересобирается в той же емкости,
+             * иначе емкость удваивается
+             */
+            void grow() {
+                if (capacity_value == 0) {
+                    rehash_to(WIDTH);
+                } else if (size_value <= max_load(capacity_value) / 2) {
+                    rehash_to(capacity_value);
+                } else {
+                    rehash_to(capacity_value * 2);
+                }
+            }
+
+            /**
+             * Вставка, если ключа еще нет. make_value создает элемент в ячейке
+             */
+            template <class K, class MakeValue>
+            std::pair<size_t, bool> insert_unique(const K& key, MakeValue make_value) {
+                uint64_t hash = hash_of(key);
+                size_t index = find_index(key, hash);
+                if (index != NOT_FOUND) return {index, false};
+
+                if (capacity_value == 0) grow();
+                index = find_free_index(hash);
+                if (controls[index] == control_empty && growth_left == 0) {
+                    grow();
+                    index = find_free_index(hash);
+                }
+                make_value(slots + index);
+                if (controls[index] == control_empty) --growth_left;
+                set_control(index, low_bits(hash));
+                ++size_value;
+                return {index, true};
+            }
+
+            /**
+             * Удаление элемента в ячейке index. Ячейку можно пометить пустой,
+             * только если ни один поиск не мог пройти через нее дальше: вокруг
+             * нее нет WIDTH подряд занятых ячеек. Иначе ставится "надгробие"
+             */
+            void erase_index(size_t index) {
+                std::destroy_at(slots + index);
+                --size_value;
+
+                size_t before = (index - WIDTH) & (capacity_value - 1);
+                auto empty_before = group(controls + before).match_empty();
+                auto empty_after = group(controls + index).match_empty();
+                bool never_full = empty_before && empty_after &&
+                                  static_cast<size_t>(empty_after.trailing_zeros() + empty_before.leading_zeros()) < WIDTH;
+                set_control(index, never_full ? control_empty : control_deleted);
+                if (never_full) ++growth_left;
+            }
+
+            void destroy_all() noexcept {
+                if (capacity_value == 0) return;
+                if constexpr (!std::is_trivially_destructible_v<Value>) {
+                    for (size_t index = 0; index < capacity_value; ++index) {
+                        if (controls[index] >= 0) std::destroy_at(slots + index);
+                    }
+                }
+                std::allocator<int8_t>().deallocate(controls, capacity_value + WIDTH);
+                std::allocator<Value>().deallocate(slots, capacity_value);
+                controls = nullptr;
+                slots = nullptr;
+                capacity_value = size_value = growth_left = 0;
+            }
+
+            iterator make_iterator(size_t index) const {
+                return basic_iterator<Value>(controls + index, slots + index, controls + capacity_value);
+            }
+
+        public:
+            swiss_table() = default;
+
+            explicit swiss_table(size_t expected_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+                : hash_function(hash), equal_function(equal) {
+                reserve(expected_count);
+            }
+
+            swiss_table(const swiss_table& other) : hash_function(other.hash_function), equal_function(other.equal_function) {
+                reserve(other.size_value);
+                for (const auto& value : other) insert(value);
+            }
+
+            swiss_table(swiss_table&& other) noexcept
+                : controls(std::exchange(other.controls, nullptr)),
+                  slots(std::exchange(other.slots, nullptr)),
+                  capacity_value(std::exchange(other.capacity_value, 0)),
+                  size_value(std::exchange(other.size_value, 0)),
+                  growth_left(std::exchange(other.growth_left, 0)),
+                  hash_function(std::move(other.hash_function)),
+                  equal_function(std::move(other.equal_function)) {
+            }
+
+            swiss_table& operator=(swiss_table other) noexcept {
+                swap(other);
+                return *this;
+            }
+
+            ~swiss_table() {
+                destroy_all();
+            }
+
+            void swap(swiss_table& other) noexcept {
+                using std::swap;
+                swap(controls, other.controls);
+                swap(slots, other.slots);
+                swap(capacity_value, other.capacity_value);
+                swap(size_value, other.size_value);
+                swap(growth_left, other.growth_left);
+                swap(hash_function, other.hash_function);
+                swap(equal_function, other.equal_function);
+            }
+
+            friend void swap(swiss_table& left, swiss_table& right) noexcept { left.swap(right); }
+
+            // ========================================================================
+            // ИТЕРАТОРЫ И РАЗМЕР
+            // ========================================================================
+
+            iterator begin() noexcept {
+                if (size_value == 0) return end();
+                iterator first = make_iterator(0);
+                first.skip_free();
+                return first;
+            }
+
+            iterator end() noexcept { return make_iterator(capacity_value); }
+            const_iterator begin() const noexcept { return const_cast<swiss_table*>(this)->begin(); }
+            const_iterator end() const noexcept { return make_iterator(capacity_value); }
+            const_iterator cbegin() const noexcept { return begin(); }
+            const_iterator cend() const noexcept { return end(); }
+
+            bool empty() const noexcept { return size_value == 0; }
+            size_type size() const noexcept { return size_value; }
+            size_type capacity() const noexcept { return capacity_value; }
+            float load_factor() const noexcept { return capacity_value ? float(size_value) / float(capacity_value) : 0.0f; }
+
+            /**
+             * Емкость под count элементов без перехеширования. Вызов перед
+             * массовой вставкой убирает цепочку ростов 16 -> 32 -> ... с
+             * переносом всех элементов на каждом шаге
+             */
+            void reserve(size_type count) {
+                if (count <= size_value + growth_left) return;
+                size_t needed = std::bit_ceil(count + (count + 6) / 7);   // заполнение не больше 7/8
+                rehash_to(std::max(needed, WIDTH));
+            }
+
+            void clear() noexcept {
+                if (capacity_value == 0) return;
+                if constexpr (!std::is_trivially_destructible_v<Value>) {
+                    for (size_t index = 0; index < capacity_value; ++index) {
+                        if (controls[index] >= 0) std::destroy_at(slots + index);
+                    }
+                }
+                std::memset(controls, static_cast<uint8_t>(control_empty), capacity_value + WIDTH);
+                size_value = 0;
+                growth_left = max_load(capacity_value);
+            }
+
+            // ========================================================================
+            // ВСТАВКА И УДАЛЕНИЕ
+            // ========================================================================
+
+            std::pair<iterator, bool> insert(const value_type& value) {
+                auto [index, inserted] = insert_unique(key_of(value), [&](Value* slot) { ::new (static_cast<void*>(slot)) Value(value); });
+                return {make_iterator(index), inserted};
+            }
+
+            std::pair<iterator, bool> insert(value_type&& value) {
+                auto [index, inserted] = insert_unique(key_of(value), [&](Value* slot) { ::new (static_cast<void*>(slot)) Value(std::move(value)); });
+                return {make_iterator(index), inserted};
+            }
+
+            template <class InputIterator>
+            void insert(InputIterator first, InputIterator last) {
+                if constexpr (std::forward_iterator<InputIterator>) reserve(size_value + static_cast<size_t>(std::distance(first, last)));
+                for (; first != last; ++first) insert(*first);
+            }
+
+            template <class... Args>
+            std::pair<iterator, bool> emplace(Args&&... args) {
+                value_type value(std::forward<Args>(args)...);
+                return insert(std::move(value));
+            }
+
+            /**
+             * Удаление по итератору. Остальные итераторы остаются действительными
+             * @return итератор на следующий элемент
+             */
+            iterator erase(const_iterator position) {
+                size_t index = static_cast<size_t>(position.control - controls);
+                erase_index(index);
+                iterator next = make_iterator(index);
+                ++next;
+                return next;
+            }
+
+            size_type erase(const key_type& key) {
+                size_t index = find_index(key, hash_of(key));
+                if (index == NOT_FOUND) return 0;
+                erase_index(index);
+                return 1;
+            }
+
+            template <class K> requires HETEROGENEOUS<K>
+            size_type erase(const K& key) {
+                size_t index = find_index(key, hash_of(key));
+                if (index == NOT_FOUND) return 0;
+                erase_index(index);
+                return 1;
+            }
+
+            // ========================================================================
+            // ПОИСК
+            // ========================================================================
+            // Если Hash и KeyEqual прозрачные (объявляют is_transparent), ключ
+            // может быть другого типа - например std::string_view для std::string
+
+            iterator find(const key_type& key) {
+                size_t index = find_index(key, hash_of(key));
+                return index == NOT_FOUND ? end() : make_iterator(index);
+            }
+
+            const_iterator find(const key_type& key) const { return const_cast<swiss_table*>(this)->find(key); }
+
+            template <class K> requires HETEROGENEOUS<K>
+            iterator find(const K& key) {
+                size_t index = find_index(key, hash_of(key));
+                return index == NOT_FOUND ? end() : make_iterator(index);
+            }
+
+            template <class K> requires HETEROGENEOUS<K>
+            const_iterator find(const K& key) const { return const_cast<swiss_table*>(this)->find(key); }
+
+            bool contains(const key_type& key) const { return find_index(key, hash_of(key)) != NOT_FOUND; }
+
+            template <class K> requires HETEROGENEOUS<K>
+            bool contains(const K& key) const { return find_index(key, hash_of(key)) != NOT_FOUND; }
+
+            size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+            template <class K> requires HETEROGENEOUS<K>
+            size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+        };
+    }
+
+    /**
+     * Хеш-множество с открытой адресацией - замена std::unordered_set
+     */
+    template <class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+    using swiss_set = detail::swiss_table<Key, Key, detail::swiss_set_key, Hash, KeyEqual>;
+
+    /**
+     * Хеш-словарь с открытой адресацией - замена std::unordered_map
+     *
+     * Элемент - std::pair<const Key, T>, как у std::unordered_map. При
+     * перехешировании ключ поэтому копируется; reserve заранее этого избегает.
+     */
+    template <class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+    class swiss_map : public detail::swiss_table<std::pair<const Key, T>, Key, detail::swiss_map_key, Hash, KeyEqual> {
+    private:
+        using base = detail::swiss_table<std::pair<const Key, T>, Key, detail::swiss_map_key, Hash, KeyEqual>;
+
+        template <class K, class... Args>
+        std::pair<typename base::iterator, bool> try_emplace_key(K&& key, Args&&... args) {
+            auto [index, inserted] = this->insert_unique(key, [&](std::pair<const Key, T>* slot) {
+                ::new (static_cast<void*>(slot)) std::pair<const Key, T>(std::piecewise_construct,
+                                                                         std::forward_as_tuple(std::forward<K>(key)),
+                                                                         std::forward_as_tuple(std::forward<Args>(args)...));
+            });
+            return {this->make_iterator(index), inserted};
+        }
+
+    public:
+        using mapped_type = T;
+        using typename base::iterator;
+        using typename base::key_type;
+
+        using base::base;
+
+        /**
+         * Вставка, если ключа еще нет: значение создается из args только
+         * при вставке
+         */
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            return try_emplace_key(key, std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& object) {
+            auto result = try_emplace_key(key, std::forward<M>(object));
+            if (!result.second) result.first->second = std::forward<M>(object);
+            return result;
+        }
+
+        T& operator[](const key_type& key) { return try_emplace_key(key).first->second; }
+        T& operator[](key_type&& key) { return try_emplace_key(std::move(key)).first->second; }
+
+        /**
+         * @throws std::out_of_range если ключа нет
+         */
+        T& at(const key_type& key) {
+            auto position = this->find(key);
+            if (position == this->end()) throw std::out_of_range("swiss_map::at: ключ не найден");
+            return position->second;
+        }
+
+        const T& at(const key_type& key) const {
+            auto position = this->find(key);
+            if (position == this->end()) throw std::out_of_range("swiss_map::at: ключ не найден");
+            return position->second;
+        }
+    };
+}
+
+#endif // SWISS_TABLE_H
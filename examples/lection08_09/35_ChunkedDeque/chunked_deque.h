@@ -0,0 +1,485 @@
+#ifndef CHUNKED_DEQUE_H
+#define CHUNKED_DEQUE_H
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mai {
+
+    /**
+     * Размер блока по умолчанию: около 4 КБ элементов, но не меньше 16 штук.
+     * В libstdc++ блок std::deque - 512 байт: 64 числа uint64_t или
+     * один элемент размером 1 КБ на блок
+     */
+    template <class T>
+    constexpr size_t default_block_size() {
+        return std::max<size_t>(4096 / sizeof(T), 16);
+    }
+
+    /**
+     * Двусторонняя очередь из блоков по BLOCK_SIZE элементов
+     *
+     * Устроена как std::deque (см. 09_Deque): массив указателей на блоки
+     * (map) и элементы подряд внутри блока. Отличия:
+     * - размер блока - параметр шаблона, а не 512 байт;
+     * - один освободившийся блок остается в запасе, поэтому очередь
+     *   "push_back в конец, pop_front из начала" не обращается к
+     *   аллокатору на каждом блоке;
+     * - итератор показывает границы блоков (сегментов): mai::for_each,
+     *   mai::copy и mai::fill обходят диапазон блок за блоком простым
+     *   циклом по указателям, без проверки границы блока на каждом шаге.
+     *
+     * Как и в libstdc++, очередь хранит два итератора: start_ на первый
+     * элемент и finish_ за последним, поэтому push/pop внутри блока - одна
+     * проверка и сдвиг указателя. Блок выделен, только когда в нем есть
+     * элементы (пустая очередь может сохранить один). Конец на границе
+     * блока - итератор с current == nullptr на еще не выделенный блок;
+     * последний указатель map_ всегда nullptr, чтобы такому итератору было
+     * куда указывать.
+     *
+     * Инвалидация: push/pop с любого конца делают недействительными
+     * итераторы (map_ может быть перевыделен), но не ссылки на остальные
+     * элементы - как у std::deque.
+     *
+     * @tparam T - тип элементов
+     * @tparam BLOCK_SIZE - число элементов в блоке
+     */
+    template <class T, size_t BLOCK_SIZE = default_block_size<T>()>
+    class chunked_deque {
+        static_assert(BLOCK_SIZE >= 1, "В блоке должен быть хотя бы один элемент");
+
+    private:
+        static constexpr std::ptrdiff_t BLOCK = static_cast<std::ptrdiff_t>(BLOCK_SIZE);
+
+        template <class Element>
+        class basic_iterator {
+        private:
+            friend class chunked_deque;
+            template <class> friend class basic_iterator;
+
+            T* const* node = nullptr;       // ячейка map_ с текущим блоком
+            Element* current = nullptr;
+            Element* block_end = nullptr;   // nullptr, если блока нет (конец)
+
+            basic_iterator(T* const* block_node, Element* position) : node(block_node), current(position) {
+                block_end = *node ? *node + BLOCK_SIZE : nullptr;
+            }
+
+            void set_node(T* const* block_node) {
+                node = block_node;
+                block_end = *node ? *node + BLOCK_SIZE : nullptr;
+            }
+
+            std::ptrdiff_t offset() const { return current - *node; }
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Element*;
+            using reference = Element&;
+
+            basic_iterator() = default;
+
+            // iterator -> const_iterator
+            operator basic_iterator<const T>() const { return {node, current}; }
+
+            reference operator*() const { return *current; }
+            pointer operator->() const { return current; }
+            reference operator[](difference_type n) const { return *(*this + n); }
+
+            basic_iterator& operator++() {
+                if (++current == block_end) {
+                    set_node(node + 1);
+                    current = *node;
+                }
+                return *this;
+            }
+
+            basic_iterator operator++(int) {
+                basic_iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            basic_iterator& operator--() {
+                if (current == *node) {
+                    set_node(node - 1);
+                    current = block_end;
+                }
+                --current;
+                return *this;
+            }
+
+            basic_iterator operator--(int) {
+                basic_iterator previous = *this;
+                --*this;
+                return previous;
+            }
+
+            basic_iterator& operator+=(difference_type n) {
+                difference_type position = offset() + n;
+                if (position >= 0 && position < BLOCK) {
+                    current += n;
+                } else {
+                    difference_type node_offset = position > 0 ? position / BLOCK : -((-position - 1) / BLOCK) - 1;
+                    set_node(node + node_offset);
+                    current = *node + (position - node_offset * BLOCK);
+                }
+                return *this;
+            }
+
+            basic_iterator& operator-=(difference_type n) { return *this += -n; }
+
+            friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+            friend basic_iterator operator+(difference_type n, basic_iterator it) { return it += n; }
+            friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+
+            friend difference_type operator-(const basic_iterator& left, const basic_iterator& right) {
+                return (left.node - right.node) * BLOCK + left.offset() - right.offset();
+            }
+
+            // Указатель current однозначно задает позицию: nullptr бывает только у конца
+            bool operator==(const basic_iterator& other) const { return current == other.current; }
+
+            std::strong_ordering operator<=>(const basic_iterator& other) const {
+                if (node != other.node) return node <=> other.node;
+                return offset() <=> other.offset();
+            }
+
+            // ---- Сегменты: обход блок за блоком (см. for_each_segment) ----
+
+            /** Указатель на текущий элемент */
+            pointer local() const { return current; }
+
+            /** Конец текущего блока */
+            pointer segment_end() const { return block_end; }
+
+            /** Итератор на начало следующего блока */
+            basic_iterator next_segment() const { return {node + 1, *(node + 1)}; }
+
+            bool same_segment(const basic_iterator& other) const { return node == other.node; }
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = basic_iterator<T>;
+        using const_iterator = basic_iterator<const T>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_t block_size = BLOCK_SIZE;
+
+        chunked_deque() = default;
+
+        chunked_deque(size_type count, const T& value) {
+            for (size_type index = 0; index < count; ++index) emplace_back(value);
+        }
+
+        template <std::input_iterator InputIterator>
+        chunked_deque(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) emplace_back(*first);
+        }
+
+        chunked_deque(std::initializer_list<T> values) : chunked_deque(values.begin(), values.end()) {
+        }
+
+        chunked_deque(const chunked_deque& other) : chunked_deque(other.begin(), other.end()) {
+        }
+
+        // Буфер vector переходит целиком, поэтому start_ и finish_ остаются действительными
+        chunked_deque(chunked_deque&& other) noexcept
+            : map_(std::move(other.map_)),
+              start_(std::exchange(other.start_, iterator(&empty_node, nullptr))),
+              finish_(std::exchange(other.finish_, iterator(&empty_node, nullptr))),
+              spare_(std::exchange(other.spare_, nullptr)) {
+            other.map_.clear();
+        }
+
+        chunked_deque& operator=(chunked_deque other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        ~chunked_deque() {
+            clear();
+            if (spare_) std::allocator<T>().deallocate(spare_, BLOCK_SIZE);
+        }
+
+        void swap(chunked_deque& other) noexcept {
+            map_.swap(other.map_);
+            std::swap(start_, other.start_);
+            std::swap(finish_, other.finish_);
+            std::swap(spare_, other.spare_);
+        }
+
+        friend void swap(chunked_deque& left, chunked_deque& right) noexcept { left.swap(right); }
+
+        // ---- Доступ ----
+
+        reference operator[](size_type position) {
+            size_type index = static_cast<size_type>(start_.offset()) + position;
+            return start_.node[index / BLOCK_SIZE][index % BLOCK_SIZE];
+        }
+
+        const_reference operator[](size_type position) const {
+            size_type index = static_cast<size_type>(start_.offset()) + position;
+            return start_.node[index / BLOCK_SIZE][index % BLOCK_SIZE];
+        }
+
+        /**
+         * @throws std::out_of_range если position >= size()
+         */
+        reference at(size_type position) {
+            if (position >= size()) throw std::out_of_range("chunked_deque::at: индекс вне диапазона");
+            return (*this)[position];
+        }
+
+        const_reference at(size_type position) const {
+            if (position >= size()) throw std::out_of_range("chunked_deque::at: индекс вне диапазона");
+            return (*this)[position];
+        }
+
+        reference front() { return *start_; }
+        const_reference front() const { return *start_; }
+        reference back() { return *std::prev(end()); }
+        const_reference back() const { return *std::prev(end()); }
+
+        iterator begin() noexcept { return start_; }
+        iterator end() noexcept { return finish_; }
+        const_iterator begin() const noexcept { return start_; }
+        const_iterator end() const noexcept { return finish_; }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        size_type size() const noexcept { return static_cast<size_type>(finish_ - start_); }
+        bool empty() const noexcept { return start_ == finish_; }
+
+        // ---- Изменение ----
+
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (!finish_.current) return emplace_back_in_new_block(std::forward<Args>(args)...);
+            T* element = ::new (static_cast<void*>(finish_.current)) T(std::forward<Args>(args)...);
+            if (++finish_.current == finish_.block_end) finish_ = iterator(finish_.node + 1, nullptr);
+            return *element;
+        }
+
+        template <class... Args>
+        reference emplace_front(Args&&... args) {
+            if (start_.current == *start_.node) return emplace_front_in_new_block(std::forward<Args>(args)...);
+            T* element = ::new (static_cast<void*>(start_.current - 1)) T(std::forward<Args>(args)...);
+            --start_.current;
+            return *element;
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+        void push_front(const T& value) { emplace_front(value); }
+        void push_front(T&& value) { emplace_front(std::move(value)); }
+
+        void pop_back() {
+            if (finish_.current == *finish_.node) finish_ = iterator(finish_.node - 1, *(finish_.node - 1) + BLOCK_SIZE);
+            std::destroy_at(--finish_.current);
+            if (finish_.current == *finish_.node) {
+                // Блок опустел: конец встает на место блока, которого больше нет
+                release_block(finish_.node);
+                finish_ = iterator(finish_.node, nullptr);
+                if (start_.node == finish_.node) start_ = finish_;
+            }
+        }
+
+        void pop_front() {
+            std::destroy_at(start_.current);
+            if (++start_.current == start_.block_end) {
+                release_block(start_.node);
+                start_ = iterator(start_.node + 1, *(start_.node + 1));
+            }
+        }
+
+        void clear() noexcept {
+            for_each_segment(begin(), end(), [](T* first, T* last) { std::destroy(first, last); });
+            if (map_.empty()) return;
+            for (T* const* node = start_.node; node <= finish_.node; ++node)
+                if (*node) release_block(node);
+            start_ = finish_ = iterator(map_.data() + block_slots() / 2, nullptr);
+        }
+
+    private:
+        // Ячейка map_ для очереди, в которую еще ничего не вставляли
+        static constexpr T* empty_node = nullptr;
+
+        std::vector<T*> map_;                      // блоки и завершающий nullptr
+        iterator start_{&empty_node, nullptr};     // первый элемент
+        iterator finish_{&empty_node, nullptr};    // за последним элементом
+        T* spare_ = nullptr;                       // освободившийся блок для повторного использования
+
+        size_type block_slots() const noexcept { return map_.empty() ? 0 : map_.size() - 1; }
+
+        T** mutable_node(T* const* node) noexcept { return map_.data() + (node - map_.data()); }
+
+        T* allocate_block() {
+            return spare_ ? std::exchange(spare_, nullptr) : std::allocator<T>().allocate(BLOCK_SIZE);
+        }
+
+        /** Блок больше не содержит элементов: он уходит в запас или освобождается */
+        void release_block(T* const* node) noexcept {
+            T*& block = *mutable_node(node);
+            if (spare_) std::allocator<T>().deallocate(block, BLOCK_SIZE);
+            else spare_ = block;
+            block = nullptr;
+        }
+
+        /**
+         * Медленный путь emplace_back: у конца нет блока (очередь пуста или
+         * последний блок заполнен) - новый блок выделяется на месте finish_
+         */
+        template <class... Args>
+        reference emplace_back_in_new_block(Args&&... args) {
+            if (map_.empty() || finish_.node == map_.data() + block_slots()) reallocate_map(false);
+            T** node = mutable_node(finish_.node);
+            *node = allocate_block();
+            T* element;
+            try {
+                element = ::new (static_cast<void*>(*node)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                release_block(node);
+                throw;
+            }
+            if (!start_.current) start_ = iterator(node, element);  // очередь была пуста
+            finish_ = element + 1 == *node + BLOCK_SIZE ? iterator(node + 1, nullptr) : iterator(node, element + 1);
+            return *element;
+        }
+
+        /**
+         * Медленный путь emplace_front: первый элемент в начале своего блока
+         * (или очередь пуста) - новый блок выделяется перед ним
+         */
+        template <class... Args>
+        reference emplace_front_in_new_block(Args&&... args) {
+            if (!start_.current) return emplace_back_in_new_block(std::forward<Args>(args)...);
+            if (start_.node == map_.data()) reallocate_map(true);
+            T** node = mutable_node(start_.node) - 1;
+            *node = allocate_block();
+            T* element;
+            try {
+                element = ::new (static_cast<void*>(*node + BLOCK_SIZE - 1)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                release_block(node);
+                throw;
+            }
+            start_ = iterator(node, element);
+            return *element;
+        }
+
+        /**
+         * Место под новый блок в начале (at_front) или в конце map_.
+         * Если map_ заполнен меньше чем наполовину, блоки только сдвигаются
+         * к середине, иначе map_ увеличивается вдвое - как в libstdc++.
+         * Сами блоки не перемещаются, поэтому ссылки на элементы остаются
+         * действительными
+         */
+        void reallocate_map(bool at_front) {
+            size_type first_node = map_.empty() ? 0 : static_cast<size_type>(start_.node - map_.data());
+            size_type used = static_cast<size_type>(finish_.node - start_.node) + 1;
+            size_type slots = block_slots();
+            if (slots < 2 * (used + 1)) slots = std::max<size_type>(8, std::max(2 * slots, 2 * (used + 1)));
+
+            size_type free_slots = slots - used;
+            size_type new_first_node = at_front ? (free_slots + 1) / 2 : free_slots / 2;
+
+            std::vector<T*> new_map(slots + 1, nullptr);
+            if (!map_.empty())
+                std::copy_n(map_.begin() + static_cast<difference_type>(first_node), used,
+                            new_map.begin() + static_cast<difference_type>(new_first_node));
+            map_.swap(new_map);
+
+            start_.node = map_.data() + new_first_node;
+            finish_.node = start_.node + (used - 1);
+        }
+    };
+
+    /**
+     * Итератор с сегментами: диапазон можно пройти по подряд лежащим
+     * в памяти кускам [local(), segment_end())
+     */
+    template <class Iterator>
+    concept segmented_iterator = requires(const Iterator& it) {
+        { it.local() } -> std::same_as<typename std::iterator_traits<Iterator>::pointer>;
+        { it.segment_end() } -> std::same_as<typename std::iterator_traits<Iterator>::pointer>;
+        { it.next_segment() } -> std::same_as<Iterator>;
+        { it.same_segment(it) } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * Вызов function(begin, end) для каждого непрерывного куска [first, last)
+     */
+    template <segmented_iterator Iterator, class Function>
+    void for_each_segment(Iterator first, Iterator last, Function function) {
+        while (!first.same_segment(last)) {
+            function(first.local(), first.segment_end());
+            first = first.next_segment();
+        }
+        if (first.local() != last.local()) function(first.local(), last.local());
+    }
+
+    /**
+     * std::for_each, для сегментированных итераторов - блок за блоком
+     */
+    template <std::input_iterator Iterator, class Function>
+    Function for_each(Iterator first, Iterator last, Function function) {
+        if constexpr (segmented_iterator<Iterator>) {
+            for_each_segment(first, last, [&function](auto begin, auto end) {
+                for (; begin != end; ++begin) function(*begin);
+            });
+            return function;
+        } else {
+            return std::for_each(first, last, function);
+        }
+    }
+
+    /**
+     * std::copy, для сегментированных итераторов - блок за блоком
+     * (для тривиально копируемых типов - memmove на блок)
+     */
+    template <std::input_iterator Iterator, class OutputIterator>
+    OutputIterator copy(Iterator first, Iterator last, OutputIterator output) {
+        if constexpr (segmented_iterator<Iterator>) {
+            for_each_segment(first, last, [&output](auto begin, auto end) { output = std::copy(begin, end, output); });
+            return output;
+        } else {
+            return std::copy(first, last, output);
+        }
+    }
+
+    /**
+     * std::fill, для сегментированных итераторов - блок за блоком
+     */
+    template <std::forward_iterator Iterator, class T>
+    void fill(Iterator first, Iterator last, const T& value) {
+        if constexpr (segmented_iterator<Iterator>) {
+            for_each_segment(first, last, [&value](auto begin, auto end) { std::fill(begin, end, value); });
+        } else {
+            std::fill(first, last, value);
+        }
+    }
+
+} // namespace mai
+
+#endif // CHUNKED_DEQUE_H
@@ -0,0 +1,211 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <deque>
+#include <queue>
+#include <stack>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "chunked_deque.h"
+
+/**
+ * Элемент размером 1 КБ. В std::deque из libstdc++ такой элемент
+ * занимает отдельный блок
+ */
+struct Kilobyte {
+    uint64_t words[128];
+};
+
+template <class T>
+T makeElement(uint64_t value) {
+    if constexpr (std::is_same_v<T, Kilobyte>) {
+        Kilobyte element{};
+        element.words[0] = value;
+        return element;
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+uint64_t elementKey(uint64_t value) { return value; }
+uint64_t elementKey(const Kilobyte& value) { return value.words[0]; }
+
+/**
+ * Текст, дополненный пробелами до width символов. std::setw считает байты,
+ * а буква кириллицы в UTF-8 занимает два байта
+ */
+std::string padded(const std::string& text, size_t width, bool align_right = false) {
+    size_t symbols = 0;
+    for (unsigned char byte : text) symbols += (byte & 0xC0) != 0x80;
+    std::string padding(width > symbols ? width - symbols : 0, ' ');
+    return align_right ? padding + text : text + padding;
+}
+
+/**
+ * Время в наносекундах на элемент
+ *
+ * @param checksum - сюда добавляется контрольное значение, чтобы
+ *                   компилятор не выбросил вычисления
+ */
+template <class Action>
+double nanosecondsPerElement(size_t count, long long& checksum, Action action) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    checksum += action();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end_time - start_time).count() / static_cast<double>(count);
+}
+
+constexpr int OPERATIONS = 6;
+const char* const OPERATION_NAMES[OPERATIONS] = {
+    "push_back", "pop_front", "обход range-for", "for_each", "copy в vector", "fill"};
+
+/**
+ * Все замеры на одном контейнере. Алгоритмы вызываются как mai::for_each,
+ * mai::copy и mai::fill: для std::deque это обычные std::for_each, std::copy
+ * и std::fill, для chunked_deque - обход по блокам
+ *
+ * @return наносекунды на элемент для каждой операции из OPERATION_NAMES
+ */
+template <class Deque>
+std::vector<double> measureDeque(size_t count, long long& checksum) {
+    using T = typename Deque::value_type;
+    std::vector<double> timings(OPERATIONS);
+    std::vector<T> output(count);
+    T filler = makeElement<T>(7);
+
+    Deque deque;
+    timings[0] = nanosecondsPerElement(count, checksum, [&] {
+        for (size_t index = 0; index < count; ++index) deque.push_back(makeElement<T>(index));
+        return static_cast<long long>(deque.size());
+    });
+    timings[2] = nanosecondsPerElement(count, checksum, [&] {
+        uint64_t sum = 0;
+        for (const T& element : deque) sum += elementKey(element);
+        return static_cast<long long>(sum);
+    });
+    timings[3] = nanosecondsPerElement(count, checksum, [&] {
+        uint64_t sum = 0;
+        mai::for_each(deque.begin(), deque.end(), [&sum](const T& element) { sum += elementKey(element); });
+        return static_cast<long long>(sum);
+    });
+    timings[4] = nanosecondsPerElement(count, checksum, [&] {
+        mai::copy(deque.begin(), deque.end(), output.begin());
+        return static_cast<long long>(elementKey(output[count / 2]));
+    });
+    timings[5] = nanosecondsPerElement(count, checksum, [&] {
+        mai::fill(deque.begin(), deque.end(), filler);
+        return static_cast<long long>(elementKey(deque[count / 2]));
+    });
+    timings[1] = nanosecondsPerElement(count, checksum, [&] {
+        long long sum = 0;
+        while (!deque.empty()) {
+            sum += static_cast<long long>(elementKey(deque.front()));
+            deque.pop_front();
+        }
+        return sum;
+    });
+    return timings;
+}
+
+/**
+ * Лучшее из трех повторов для каждой операции
+ */
+template <class Deque>
+std::vector<double> bestOfThree(size_t count, long long& checksum) {
+    std::vector<double> best = measureDeque<Deque>(count, checksum);
+    for (int repeat = 1; repeat < 3; ++repeat) {
+        std::vector<double> timings = measureDeque<Deque>(count, checksum);
+        for (int operation = 0; operation < OPERATIONS; ++operation)
+            best[operation] = std::min(best[operation], timings[operation]);
+    }
+    return best;
+}
+
+/**
+ * Сравнение std::deque, chunked_deque с блоком 512 байт (как в libstdc++)
+ * и chunked_deque с блоком по умолчанию на count элементах типа T
+ */
+template <class T>
+void compareDeques(const std::string& type_name, size_t count, long long& checksum) {
+    constexpr size_t SMALL_BLOCK = std::max<size_t>(512 / sizeof(T), 1);
+    constexpr size_t DEFAULT_BLOCK = mai::default_block_size<T>();
+
+    std::vector<double> standard = bestOfThree<std::deque<T>>(count, checksum);
+    std::vector<double> small_blocks = bestOfThree<mai::chunked_deque<T, SMALL_BLOCK>>(count, checksum);
+    std::vector<double> large_blocks = bestOfThree<mai::chunked_deque<T, DEFAULT_BLOCK>>(count, checksum);
+
+    std::cout << "\n   " << type_name << ", " << count << " элементов (нс на элемент):" << std::endl;
+    std::cout << "      " << padded("операция", 20) << padded("std::deque", 13, true)
+              << padded("блок " + std::to_string(SMALL_BLOCK), 13, true)
+              << padded("блок " + std::to_string(DEFAULT_BLOCK), 13, true) << std::endl;
+    for (int operation = 0; operation < OPERATIONS; ++operation) {
+        std::cout << "      " << padded(OPERATION_NAMES[operation], 20) << std::fixed << std::setprecision(2)
+                  << std::setw(13) << standard[operation] << std::setw(13) << small_blocks[operation]
+                  << std::setw(13) << large_blocks[operation] << std::endl;
+    }
+}
+
+/**
+ * Основная функция - демонстрация chunked_deque
+ */
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::cout << "=== CHUNKED_DEQUE: РАЗМЕР БЛОКА И ОБХОД ПО СЕГМЕНТАМ ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: СЕГМЕНТЫ ВИДНЫ ЧЕРЕЗ ИТЕРАТОР (СМ. 09_Deque)
+    // ========================================================================
+    std::cout << "\n1. chunked_deque<int, 4> - блоки по 4 элемента:" << std::endl;
+    {
+        mai::chunked_deque<int, 4> deque_data = {3, 4, 5, 6, 7, 8};
+        deque_data.push_front(2);
+        deque_data.push_front(1);
+        deque_data.push_back(9);
+
+        // 09_Deque ищет границы блоков по скачкам адресов, здесь они известны итератору
+        std::cout << "   Сегменты:";
+        mai::for_each_segment(deque_data.begin(), deque_data.end(), [](int* first, int* last) {
+            std::cout << " [";
+            for (int* element = first; element != last; ++element)
+                std::cout << *element << (element + 1 != last ? " " : "");
+            std::cout << "]";
+        });
+        std::cout << std::endl;
+
+        mai::fill(deque_data.begin() + 2, deque_data.end() - 2, 0);
+        std::cout << "   После mai::fill середины:";
+        for (int element : deque_data) std::cout << " " << element;
+        std::cout << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: КОНТЕЙНЕР ДЛЯ STD::QUEUE И STD::STACK (СМ. 10_Stack, 11_Queue)
+    // ========================================================================
+    std::cout << "\n2. std::queue и std::stack поверх chunked_deque:" << std::endl;
+    {
+        std::queue<std::string, mai::chunked_deque<std::string>> queue_data;
+        std::stack<std::string, mai::chunked_deque<std::string>> stack_data;
+        for (std::string word : {"first", "second", "third"}) {
+            queue_data.push(word);
+            stack_data.push(word);
+        }
+        std::cout << "   queue.front(): " << queue_data.front() << ", stack.top(): " << stack_data.top() << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: ПРОИЗВОДИТЕЛЬНОСТЬ
+    // ========================================================================
+    std::cout << "\n3. Сравнение с std::deque:" << std::endl;
+    long long checksum = 0;
+    compareDeques<uint64_t>("uint64_t", count, checksum);
+    compareDeques<Kilobyte>("Kilobyte (1 КБ)", std::max<size_t>(count / 100, 1), checksum);
+    std::cout << "\n   Контрольная сумма: " << checksum << std::endl;
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <stack>
+#include <queue>
+#include <span>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+#include "small_vector.h"
+
+/**
+ * Текст, дополненный пробелами до width символов. std::setw считает байты,
+ * а буква кириллицы в UTF-8 занимает два байта
+ */
+std::string padded(const std::string& text, size_t width, bool align_right = false) {
+    size_t symbols = 0;
+    for (unsigned char byte : text) symbols += (byte & 0xC0) != 0x80;
+    std::string padding(width > symbols ? width - symbols : 0, ' ');
+    return align_right ? padding + text : text + padding;
+}
+
+// Количество исходных чисел - степень двойки, чтобы индекс брался маской, а не делением
+constexpr size_t VALUES = 1024;
+
+/**
+ * std::stack с доступом к базовому контейнеру: член c у адаптера защищенный
+ */
+template <class Container>
+struct InspectableStack : std::stack<typename Container::value_type, Container> {
+    using std::stack<typename Container::value_type, Container>::c;
+};
+
+/**
+ * Один раунд "горячего цикла": локальный адаптер создается заново,
+ * в него кладется depth чисел, затем все извлекаются
+ *
+ * @return сумма извлеченных чисел
+ */
+template <class Adapter>
+long long runRound(const std::vector<int>& values, size_t offset, size_t depth) {
+    Adapter adapter;
+    for (size_t index = 0; index < depth; ++index)
+        adapter.push(values[(offset + index) & (VALUES - 1)]);
+
+    long long sum = 0;
+    while (!adapter.empty()) {
+        if constexpr (requires { adapter.top(); }) sum += adapter.top();
+        else sum += adapter.front();
+        adapter.pop();
+    }
+    return sum;
+}
+
+/**
+ * Наносекунды на раунд, лучшее из трех повторов
+ */
+template <class Adapter>
+double nanosecondsPerRound(const std::vector<int>& values, size_t rounds, size_t depth, long long& checksum) {
+    double best = 0;
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        for (size_t round = 0; round < rounds; ++round)
+            checksum += runRound<Adapter>(values, round, depth);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        double time = std::chrono::duration<double, std::nano>(end_time - start_time).count() / static_cast<double>(rounds);
+        if (repeat == 0 || time < best) best = time;
+    }
+    return best;
+}
+
+void printRow(const std::string& name, const std::vector<double>& timings) {
+    std::cout << "      " << padded(name, 26) << std::fixed << std::setprecision(1);
+    for (double time : timings) {
+        if (time < 0) std::cout << padded("-", 15, true);
+        else std::cout << std::setw(15) << time;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * Основная функция - демонстрация static_vector и small_vector
+ */
+int main(int argc, char* argv[]) {
+    size_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    std::cout << "=== STATIC_VECTOR И SMALL_VECTOR: БЕЗ КУЧИ ДЛЯ МАЛЫХ РАЗМЕРОВ ===" << std::endl;
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 1: STATIC_VECTOR - ЕМКОСТЬ ВНУТРИ ОБЪЕКТА
+    // ========================================================================
+    std::cout << "\n1. static_vector<int, 4>:" << std::endl;
+    {
+        mai::static_vector<int, 4> numbers = {1, 2, 3};
+        numbers.push_back(4);
+        std::cout << "   sizeof: " << sizeof(numbers) << " байт, элементы:";
+        for (int number : numbers) std::cout << " " << number;
+        std::cout << std::endl;
+        try {
+            numbers.push_back(5);
+        } catch (const std::length_error& error) {
+            std::cout << "   push_back в полный вектор: " << error.what() << std::endl;
+        }
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 2: SMALL_VECTOR - ПЕРЕХОД В КУЧУ ПРИ ПЕРЕПОЛНЕНИИ
+    // ========================================================================
+    std::cout << "\n2. small_vector<std::string, 2>:" << std::endl;
+    {
+        mai::small_vector<std::string, 2> words = {"alpha", "beta"};
+        std::cout << "   " << words.size() << " элемента, встроенный буфер: " << (words.is_inline() ? "да" : "нет") << std::endl;
+        words.push_back("gamma");
+        std::cout << "   " << words.size() << " элемента, встроенный буфер: " << (words.is_inline() ? "да" : "нет")
+                  << ", емкость " << words.capacity() << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 3: КОНТЕЙНЕР ДЛЯ STD::STACK И STD::QUEUE (СМ. 10_Stack, 11_Queue)
+    // ========================================================================
+    std::cout << "\n3. std::stack и std::queue поверх static_vector:" << std::endl;
+    {
+        InspectableStack<mai::static_vector<int, 16>> stack_data;
+        std::queue<int, mai::static_vector<int, 16>> queue_data;
+        for (int value = 1; value <= 5; ++value) {
+            stack_data.push(value * 10);
+            queue_data.push(value * 10);
+        }
+        stack_data.pop();
+        queue_data.pop();
+        std::cout << "   stack.top(): " << stack_data.top() << ", queue.front(): " << queue_data.front() << std::endl;
+
+        // У std::stack нет итераторов (см. 10_Stack), но элементы static_vector лежат подряд
+        std::span<const int> elements(stack_data.c.data(), stack_data.c.size());
+        std::cout << "   Все элементы стека одним span:";
+        for (int element : elements) std::cout << " " << element;
+        std::cout << std::endl;
+    }
+
+    // ========================================================================
+    // ДЕМОНСТРАЦИЯ 4: ПРОИЗВОДИТЕЛЬНОСТЬ
+    // ========================================================================
+    std::cout << "\n4. Горячий цикл: создать адаптер, положить depth чисел, извлечь все ("
+              << rounds << " раундов, нс на раунд):" << std::endl;
+
+    std::vector<int> values(VALUES);
+    std::mt19937 generator(42);
+    for (int& value : values) value = static_cast<int>(generator() % 1000);
+    long long checksum = 0;
+
+    std::cout << "      " << padded("адаптер", 26) << padded("std::deque", 15, true) << padded("std::vector", 15, true)
+              << padded("static_vector", 15, true) << padded("small_vector", 15, true) << std::endl;
+
+    for (size_t depth : {4, 16}) {
+        printRow("stack, depth " + std::to_string(depth), {
+            nanosecondsPerRound<std::stack<int>>(values, rounds, depth, checksum),
+            nanosecondsPerRound<std::stack<int, std::vector<int>>>(values, rounds, depth, checksum),
+            nanosecondsPerRound<std::stack<int, mai::static_vector<int, 16>>>(values, rounds, depth, checksum),
+            nanosecondsPerRound<std::stack<int, mai::small_vector<int, 16>>>(values, rounds, depth, checksum)});
+        printRow("queue, depth " + std::to_string(depth), {
+            nanosecondsPerRound<std::queue<int>>(values, rounds, depth, checksum),
+            -1,
+            nanosecondsPerRound<std::queue<int, mai::static_vector<int, 16>>>(values, rounds, depth, checksum),
+            nanosecondsPerRound<std::queue<int, mai::small_vector<int, 16>>>(values, rounds, depth, checksum)});
+    }
+    // small_vector<int, 16> уходит в кучу, static_vector<int, 16> столько не вмещает
+    printRow("stack, depth 64", {
+        nanosecondsPerRound<std::stack<int>>(values, rounds, 64, checksum),
+        nanosecondsPerRound<std::stack<int, std::vector<int>>>(values, rounds, 64, checksum),
+        -1,
+        nanosecondsPerRound<std::stack<int, mai::small_vector<int, 16>>>(values, rounds, 64, checksum)});
+
+    std::cout << "\n   Контрольная сумма: " << checksum << std::endl;
+
+    std::cout << "\n=== ДЕМОНСТРАЦИЯ ЗАВЕРШЕНА ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,482 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mai {
+
+    namespace detail {
+
+        /**
+         * Общая часть static_vector и small_vector: доступ к элементам,
+         * итераторы, удаление и сравнение. Derived хранит элементы подряд
+         * и предоставляет data(), size(), set_size() и drop_front()
+         */
+        template <class Derived, class T>
+        class inline_vector_operations {
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            iterator begin() noexcept { return self().data(); }
+            iterator end() noexcept { return self().data() + self().size(); }
+            const_iterator begin() const noexcept { return self().data(); }
+            const_iterator end() const noexcept { return self().data() + self().size(); }
+            const_iterator cbegin() const noexcept { return begin(); }
+            const_iterator cend() const noexcept { return end(); }
+            reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+            reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+            const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+            const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+            bool empty() const noexcept { return self().size() == 0; }
+
+            reference operator[](size_type position) { return self().data()[position]; }
+            const_reference operator[](size_type position) const { return self().data()[position]; }
+
+            /**
+             * @throws std::out_of_range если position >= size()
+             */
+            reference at(size_type position) {
+                if (position >= self().size()) throw std::out_of_range("at: индекс вне диапазона");
+                return self().data()[position];
+            }
+
+            const_reference at(size_type position) const {
+                if (position >= self().size()) throw std::out_of_range("at: индекс вне диапазона");
+                return self().data()[position];
+            }
+
+            reference front() { return *begin(); }
+            const_reference front() const { return *begin(); }
+            reference back() { return *(end() - 1); }
+            const_reference back() const { return *(end() - 1); }
+
+            void pop_back() {
+                std::destroy_at(end() - 1);
+                self().set_size(self().size() - 1);
+            }
+
+            /**
+             * Удаление первого элемента без сдвига остальных: начало
+             * вектора сдвигается вперед, а освободившееся место
+             * используется, когда push_back дойдет до конца буфера.
+             * Нужен std::queue
+             */
+            void pop_front() {
+                std::destroy_at(begin());
+                self().drop_front();
+            }
+
+            iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+            iterator erase(const_iterator first, const_iterator last) {
+                iterator target = begin() + (first - cbegin());
+                if (first != last) {
+                    iterator new_end = std::move(target + (last - first), end(), target);
+                    std::destroy(new_end, end());
+                    self().set_size(static_cast<size_type>(new_end - begin()));
+                }
+                return target;
+            }
+
+            void clear() noexcept {
+                std::destroy(begin(), end());
+                self().set_size(0);
+            }
+
+            friend bool operator==(const Derived& left, const Derived& right) {
+                return std::equal(left.begin(), left.end(), right.begin(), right.end());
+            }
+
+            friend auto operator<=>(const Derived& left, const Derived& right) {
+                return std::lexicographical_compare_three_way(left.begin(), left.end(), right.begin(), right.end());
+            }
+
+        private:
+            Derived& self() noexcept { return static_cast<Derived&>(*this); }
+            const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+        };
+
+        /**
+         * Сдвиг count элементов из source в начало буфера target (target
+         * левее source): каждый элемент перемещается и сразу уничтожается
+         * на старом месте, поэтому диапазоны могут перекрываться. Если
+         * перемещение бросит исключение, уничтожаются все элементы -
+         * вызывающий код делает вектор пустым
+         */
+        template <class T>
+        void shift_to_front(T* source, size_t count, T* target) {
+            size_t moved = 0;
+            try {
+                for (; moved < count; ++moved) {
+                    ::new (static_cast<void*>(target + moved)) T(std::move(source[moved]));
+                    std::destroy_at(source + moved);
+                }
+            } catch (...) {
+                std::destroy(target, target + moved);
+                std::destroy(source + moved, source + count);
+                throw;
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * Вектор с емкостью N внутри самого объекта - без обращений к куче
+     *
+     * Элементы лежат в массиве storage_ прямо в объекте (на стеке, если
+     * объект локальный), поэтому push_back никогда не выделяет память.
+     * Емкость не растет: push_back в полный вектор бросает std::length_error.
+     *
+     * Подходит как контейнер для std::stack и std::queue. pop_front не
+     * сдвигает элементы, а увеличивает смещение начала head_; когда
+     * push_back доходит до конца буфера, элементы сдвигаются в его начало.
+     * Поэтому push_back после pop_front может сделать недействительными
+     * ссылки на элементы - как перевыделение у std::vector.
+     *
+     * @tparam T - тип элементов
+     * @tparam N - емкость
+     */
+    template <class T, size_t N>
+    class static_vector : public detail::inline_vector_operations<static_vector<T, N>, T> {
+        static_assert(N > 0, "Емкость должна быть больше нуля");
+
+    private:
+        using base = detail::inline_vector_operations<static_vector<T, N>, T>;
+        friend base;
+
+        size_t head_ = 0;   // начало элементов после pop_front
+        size_t size_ = 0;
+        alignas(T) unsigned char storage_[N * sizeof(T)];
+
+        T* storage() noexcept { return reinterpret_cast<T*>(storage_); }
+
+        void set_size(size_t new_size) noexcept {
+            size_ = new_size;
+            if (size_ == 0) head_ = 0;
+        }
+
+        void drop_front() noexcept {
+            ++head_;
+            set_size(size_ - 1);
+        }
+
+        /**
+         * Медленный путь emplace_back: буфер кончился. Новый элемент
+         * создается до сдвига - args может ссылаться на элемент вектора
+         */
+        template <class... Args>
+        T& emplace_back_after_shift(Args&&... args) {
+            if (size_ == N) throw std::length_error("static_vector: емкость исчерпана");
+            T value(std::forward<Args>(args)...);
+            try {
+                detail::shift_to_front(data(), size_, storage());
+            } catch (...) {
+                set_size(0);
+                throw;
+            }
+            head_ = 0;
+            T* element = ::new (static_cast<void*>(storage() + size_)) T(std::move(value));
+            ++size_;
+            return *element;
+        }
+
+        void take(static_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            std::uninitialized_move(other.begin(), other.end(), storage());
+            size_ = other.size_;
+            other.clear();
+        }
+
+    public:
+        using typename base::size_type;
+        using typename base::reference;
+
+        static_vector() noexcept {
+        }
+
+        static_vector(size_type count, const T& value) {
+            while (size_ < count) emplace_back(value);
+        }
+
+        template <std::input_iterator InputIterator>
+        static_vector(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) emplace_back(*first);
+        }
+
+        static_vector(std::initializer_list<T> values) : static_vector(values.begin(), values.end()) {
+        }
+
+        static_vector(const static_vector& other) : static_vector(other.begin(), other.end()) {
+        }
+
+        static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            take(other);
+        }
+
+        static_vector& operator=(const static_vector& other) {
+            if (this != &other) {
+                this->clear();
+                for (const T& value : other) emplace_back(value);
+            }
+            return *this;
+        }
+
+        static_vector& operator=(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                this->clear();
+                take(other);
+            }
+            return *this;
+        }
+
+        ~static_vector() {
+            this->clear();
+        }
+
+        T* data() noexcept { return reinterpret_cast<T*>(storage_) + head_; }
+        const T* data() const noexcept { return reinterpret_cast<const T*>(storage_) + head_; }
+
+        size_type size() const noexcept { return size_; }
+        static constexpr size_type capacity() noexcept { return N; }
+        bool full() const noexcept { return size_ == N; }
+
+        /**
+         * @throws std::length_error если вектор полон
+         */
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (head_ + size_ == N) return emplace_back_after_shift(std::forward<Args>(args)...);
+            T* element = ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+            ++size_;
+            return *element;
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+    };
+
+    /**
+     * Вектор с первыми N элементами внутри объекта и переходом в кучу
+     * при переполнении (small buffer optimization, как у std::string)
+     *
+     * Пока элементов не больше N, они лежат во встроенном буфере и куча
+     * не используется. При переполнении элементы переезжают в выделенный
+     * массив, который растет вдвое, как у std::vector; обратно во встроенный
+     * буфер вектор не возвращается.
+     *
+     * pop_front, как у static_vector, увеличивает смещение начала. Когда
+     * push_back доходит до конца буфера, элементы сдвигаются в его начало,
+     * если буфер свободен хотя бы наполовину, иначе буфер растет.
+     *
+     * @tparam T - тип элементов
+     * @tparam N - емкость встроенного буфера
+     */
+    template <class T, size_t N>
+    class small_vector : public detail::inline_vector_operations<small_vector<T, N>, T> {
+        static_assert(N > 0, "Емкость встроенного буфера должна быть больше нуля");
+
+    private:
+        using base = detail::inline_vector_operations<small_vector<T, N>, T>;
+        friend base;
+
+        T* buffer_;         // встроенный буфер или массив в куче
+        size_t head_ = 0;   // начало элементов после pop_front
+        size_t size_ = 0;
+        size_t capacity_ = N;
+        alignas(T) unsigned char inline_storage_[N * sizeof(T)];
+
+        T* inline_data() noexcept { return reinterpret_cast<T*>(inline_storage_); }
+        const T* inline_data() const noexcept { return reinterpret_cast<const T*>(inline_storage_); }
+
+        void set_size(size_t new_size) noexcept {
+            size_ = new_size;
+            if (size_ == 0) head_ = 0;
+        }
+
+        void drop_front() noexcept {
+            ++head_;
+            set_size(size_ - 1);
+        }
+
+        /**
+         * Перенос элементов в new_data: перемещением, если оно не бросает
+         * исключений, иначе копированием (как std::vector)
+         */
+        void relocate_to(T* new_data) {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                std::uninitialized_move(data(), data() + size_, new_data);
+            else
+                std::uninitialized_copy(data(), data() + size_, new_data);
+        }
+
+        /** Замена буфера: старые элементы уничтожаются, куча освобождается */
+        void adopt(T* new_buffer, size_t new_capacity) noexcept {
+            std::destroy(data(), data() + size_);
+            if (!is_inline()) std::allocator<T>().deallocate(buffer_, capacity_);
+            buffer_ = new_buffer;
+            head_ = 0;
+            capacity_ = new_capacity;
+        }
+
+        /**
+         * Медленный путь emplace_back: буфер кончился. Новый элемент
+         * создается до переноса старых - args может ссылаться на элемент
+         * этого вектора
+         */
+        template <class... Args>
+        T& emplace_back_slow(Args&&... args) {
+            if (2 * size_ <= capacity_) {
+                // Свободна хотя бы половина буфера (в начале) - сдвиг без выделения памяти
+                T value(std::forward<Args>(args)...);
+                try {
+                    detail::shift_to_front(data(), size_, buffer_);
+                } catch (...) {
+                    set_size(0);
+                    throw;
+                }
+                head_ = 0;
+                T* element = ::new (static_cast<void*>(buffer_ + size_)) T(std::move(value));
+                ++size_;
+                return *element;
+            }
+
+            size_t new_capacity = 2 * capacity_;
+            T* new_buffer = std::allocator<T>().allocate(new_capacity);
+            T* element;
+            try {
+                element = ::new (static_cast<void*>(new_buffer + size_)) T(std::forward<Args>(args)...);
+                try {
+                    relocate_to(new_buffer);
+                } catch (...) {
+                    std::destroy_at(element);
+                    throw;
+                }
+            } catch (...) {
+                std::allocator<T>().deallocate(new_buffer, new_capacity);
+                throw;
+            }
+            adopt(new_buffer, new_capacity);
+            ++size_;
+            return *element;
+        }
+
+        /** Забрать массив other из кучи или переместить его встроенные элементы */
+        void take(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (other.is_inline()) {
+                std::uninitialized_move(other.begin(), other.end(), buffer_);
+                size_ = other.size_;
+                other.clear();
+            } else {
+                buffer_ = std::exchange(other.buffer_, other.inline_data());
+                head_ = std::exchange(other.head_, 0);
+                size_ = std::exchange(other.size_, 0);
+                capacity_ = std::exchange(other.capacity_, N);
+            }
+        }
+
+    public:
+        using typename base::size_type;
+        using typename base::reference;
+
+        small_vector() noexcept : buffer_(inline_data()) {
+        }
+
+        small_vector(size_type count, const T& value) : small_vector() {
+            reserve(count);
+            while (size_ < count) emplace_back(value);
+        }
+
+        template <std::input_iterator InputIterator>
+        small_vector(InputIterator first, InputIterator last) : small_vector() {
+            if constexpr (std::forward_iterator<InputIterator>)
+                reserve(static_cast<size_type>(std::distance(first, last)));
+            for (; first != last; ++first) emplace_back(*first);
+        }
+
+        small_vector(std::initializer_list<T> values) : small_vector(values.begin(), values.end()) {
+        }
+
+        small_vector(const small_vector& other) : small_vector(other.begin(), other.end()) {
+        }
+
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : small_vector() {
+            take(other);
+        }
+
+        small_vector& operator=(const small_vector& other) {
+            if (this != &other) {
+                this->clear();
+                reserve(other.size_);
+                for (const T& value : other) emplace_back(value);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                adopt(inline_data(), N);
+                size_ = 0;
+                take(other);
+            }
+            return *this;
+        }
+
+        ~small_vector() {
+            adopt(nullptr, 0);
+        }
+
+        T* data() noexcept { return buffer_ + head_; }
+        const T* data() const noexcept { return buffer_ + head_; }
+
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_; }
+
+        /** Элементы во встроенном буфере (куча не используется) */
+        bool is_inline() const noexcept { return buffer_ == inline_data(); }
+
+        void reserve(size_type new_capacity) {
+            if (new_capacity <= capacity_) return;
+            T* new_buffer = std::allocator<T>().allocate(new_capacity);
+            try {
+                relocate_to(new_buffer);
+            } catch (...) {
+                std::allocator<T>().deallocate(new_buffer, new_capacity);
+                throw;
+            }
+            adopt(new_buffer, new_capacity);
+        }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (head_ + size_ == capacity_) return emplace_back_slow(std::forward<Args>(args)...);
+            T* element = ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+            ++size_;
+            return *element;
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+    };
+
+} // namespace mai
+
+#endif // SMALL_VECTOR_H
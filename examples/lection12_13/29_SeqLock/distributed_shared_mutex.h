@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+/**
+ * Распределенный (per-core) reader-writer lock для больших структур.
+ *
+ * std::shared_mutex хранит один общий счетчик читателей, и каждый
+ * lock_shared() пишет в одну и ту же кэш-линию - при десятках читателей
+ * она постоянно "прыгает" между ядрами. Здесь счетчик читателей разбит на
+ * SLOTS независимых слотов, каждый в своей кэш-линии. Поток закрепляется за
+ * слотом при первом обращении, поэтому читатели на разных ядрах не мешают
+ * друг другу. Писатель выставляет флаг и ждет, пока все слоты опустеют -
+ * запись становится дороже, чтение - дешевле.
+ *
+ * Совместим с std::shared_lock и std::lock_guard / std::unique_lock.
+ *
+ * @tparam SLOTS - количество слотов (обычно не меньше числа ядер)
+ */
+template <size_t SLOTS = 64>
+class distributed_shared_mutex
+{
+private:
+    struct alignas(64) slot
+    {
+        std::atomic<long> readers{0};
+    };
+
+    std::array<slot, SLOTS> slots;
+    alignas(64) std::atomic<bool> writer{false};
+    std::mutex writers; // Писатели упорядочиваются обычным мьютексом
+
+    static size_t my_slot()
+    {
+        static std::atomic<size_t> next_slot{0};
+        thread_local size_t index = next_slot.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+        return index;
+    }
+
+public:
+    distributed_shared_mutex() = default;
+    distributed_shared_mutex(const distributed_shared_mutex &) = delete;
+    distributed_shared_mutex &operator=(const distributed_shared_mutex &) = delete;
+
+    void lock_shared()
+    {
+        std::atomic<long> &counter = slots[my_slot()].readers;
+        for (;;)
+        {
+            // seq_cst: инкремент должен быть виден писателю раньше, чем мы прочтем флаг
+            counter.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer.load(std::memory_order_seq_cst))
+                return;
+            counter.fetch_sub(1, std::memory_order_release);
+            while (writer.load(std::memory_order_relaxed))
+                std::this_thread::yield();
+        }
+    }
+
+    bool try_lock_shared()
+    {
+        std::atomic<long> &counter = slots[my_slot()].readers;
+        counter.fetch_add(1, std::memory_order_seq_cst);
+        if (!writer.load(std::memory_order_seq_cst))
+            return true;
+        counter.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    void unlock_shared()
+    {
+        slots[my_slot()].readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void lock()
+    {
+        writers.lock();
+        writer.store(true, std::memory_order_seq_cst);
+        // seq_cst и для счетчиков: пара с lock_shared() - как у Деккера, кто-то
+        // из двоих обязательно увидит запись другого. acquire-чтение не входит
+        // в единый порядок seq_cst, и писатель мог бы прочесть 0 одновременно
+        // с читателем, который не видит флаг
+        for (auto &s : slots)
+            while (s.readers.load(std::memory_order_seq_cst) != 0)
+                std::this_thread::yield();
+    }
+
+    bool try_lock()
+    {
+        if (!writers.try_lock())
+            return false;
+        writer.store(true, std::memory_order_seq_cst);
+        for (auto &s : slots)
+            if (s.readers.load(std::memory_order_seq_cst) != 0)
+            {
+                writer.store(false, std::memory_order_release);
+                writers.unlock();
+                return false;
+            }
+        return true;
+    }
+
+    void unlock()
+    {
+        writer.store(false, std::memory_order_release);
+        writers.unlock();
+    }
+};
@@ -0,0 +1,141 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include "seqlock.h"
+#include "distributed_shared_mutex.h"
+
+/**
+ * Данные, которые часто читают и редко пишут.
+ * Писатель всегда записывает во все поля одно и то же число,
+ * поэтому читатель легко проверит, что не увидел "разорванное" значение.
+ */
+struct Config
+{
+    long values[8];
+};
+
+/**
+ * Обертка над данными под std::shared_mutex (как в 16_SharedLock)
+ */
+template <class Mutex>
+struct locked_config
+{
+    mutable Mutex mtx;
+    Config data{};
+
+    Config load() const
+    {
+        std::shared_lock<Mutex> lock(mtx);
+        return data;
+    }
+
+    void store(const Config &value)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        data = value;
+    }
+};
+
+/**
+ * Seqlock с тем же интерфейсом load/store
+ */
+struct seqlock_config
+{
+    seqlock<Config> data;
+
+    Config load() const { return data.load(); }
+    void store(const Config &value) { data.store(value); }
+};
+
+struct result
+{
+    double reads_per_ms;
+    long torn_reads;
+};
+
+/**
+ * Запускает readers читателей и одного писателя на duration.
+ * Писатель обновляет данные примерно раз в 50 микросекунд.
+ */
+template <class Storage>
+result run(int readers, std::chrono::milliseconds duration)
+{
+    Storage storage;
+    std::atomic<bool> stop{false};
+    std::atomic<long> total_reads{0};
+    std::atomic<long> torn_reads{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers; ++i)
+        threads.emplace_back([&]()
+                             {
+            long reads = 0, torn = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                Config c = storage.load();
+                for (long v : c.values)
+                    if (v != c.values[0]) { ++torn; break; }
+                ++reads;
+            }
+            total_reads += reads;
+            torn_reads += torn; });
+
+    threads.emplace_back([&]()
+                         {
+        long version = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            Config c;
+            ++version;
+            for (long &v : c.values) v = version;
+            storage.store(c);
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        } });
+
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto &t : threads)
+        t.join();
+
+    return {double(total_reads.load()) / duration.count(), torn_reads.load()};
+}
+
+int main(int argc, char *argv[])
+{
+    std::chrono::milliseconds duration(argc > 1 ? std::stoi(argv[1]) : 200);
+
+    std::cout << "=== ЧТЕНИЕ С ОДНИМ ПИСАТЕЛЕМ: shared_mutex / seqlock / distributed ===" << std::endl;
+    std::cout << "Аппаратных потоков: " << std::thread::hardware_concurrency()
+              << ", длительность замера: " << duration.count() << " мс" << std::endl;
+    std::cout << "(чтений в миллисекунду, в скобках - \"разорванные\" чтения)" << std::endl
+              << std::endl;
+
+    std::cout << std::setw(8) << "readers"
+              << std::setw(22) << "std::shared_mutex"
+              << std::setw(22) << "seqlock"
+              << std::setw(22) << "distributed" << std::endl;
+
+    for (int readers = 1; readers <= 64; readers *= 2)
+    {
+        result shared = run<locked_config<std::shared_mutex>>(readers, duration);
+        result seq = run<seqlock_config>(readers, duration);
+        result distributed = run<locked_config<distributed_shared_mutex<64>>>(readers, duration);
+
+        auto cell = [](const result &r)
+        {
+            return std::to_string(long(r.reads_per_ms)) + " (" + std::to_string(r.torn_reads) + ")";
+        };
+
+        std::cout << std::setw(8) << readers
+                  << std::setw(22) << cell(shared)
+                  << std::setw(22) << cell(seq)
+                  << std::setw(22) << cell(distributed) << std::endl;
+    }
+
+    return 0;
+}
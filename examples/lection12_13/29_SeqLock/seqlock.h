@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <thread>
+
+/**
+ * Seqlock (sequence lock) для небольших тривиально копируемых данных.
+ *
+ * Читатель ничего не пишет в общую память: он читает счетчик версии,
+ * копирует данные и перечитывает счетчик. Если за это время писатель
+ * успел что-то поменять (счетчик нечетный или изменился) - чтение повторяется.
+ *
+ * Данные хранятся как массив атомарных слов, которые читаются и пишутся
+ * с memory_order_relaxed - так нет гонки данных с точки зрения стандарта,
+ * а на x86/ARM это компилируется в обычные mov/ldr.
+ *
+ * @tparam T - тривиально копируемый тип (структура из нескольких полей)
+ */
+template <class T>
+    requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+class seqlock
+{
+private:
+    static constexpr size_t word_count = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> sequence{0};   // Четное - данные стабильны, нечетное - идет запись
+    std::array<std::atomic<uint64_t>, word_count> words{};
+
+    void store_words(const T &value)
+    {
+        uint64_t buffer[word_count]{};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < word_count; ++i)
+            words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+public:
+    seqlock() { store_words(T{}); }
+    explicit seqlock(const T &value) { store_words(value); }
+
+    seqlock(const seqlock &) = delete;
+    seqlock &operator=(const seqlock &) = delete;
+
+    /**
+     * Чтение снимка данных. Никогда не блокируется писателем надолго
+     * и не пишет в разделяемую память.
+     */
+    T load() const
+    {
+        uint64_t buffer[word_count];
+        uint64_t before, after;
+        do
+        {
+            before = sequence.load(std::memory_order_acquire);
+            while (before & 1) // Писатель внутри - ждем окончания записи
+            {
+                std::this_thread::yield();
+                before = sequence.load(std::memory_order_acquire);
+            }
+            for (size_t i = 0; i < word_count; ++i)
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while (before != after);
+
+        T result;
+        std::memcpy(&result, buffer, sizeof(T));
+        return result;
+    }
+
+    /**
+     * Запись нового значения
+     */
+    void store(const T &value)
+    {
+        uint64_t current = begin_write();
+        store_words(value);
+        end_write(current);
+    }
+
+    /**
+     * Изменение по месту: f получает текущее значение и меняет его.
+     * Весь вызов выполняется внутри секции записи, поэтому конкурирующие
+     * писатели не потеряют обновления друг друга.
+     */
+    template <class F>
+    void update(F &&f)
+    {
+        uint64_t current = begin_write();
+        uint64_t buffer[word_count];
+        for (size_t i = 0; i < word_count; ++i)
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        f(value);
+        store_words(value);
+        end_write(current);
+    }
+
+private:
+    // Писатели упорядочиваются между собой захватом нечетного значения счетчика через CAS
+    uint64_t begin_write()
+    {
+        uint64_t current = sequence.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (!(current & 1) &&
+                sequence.compare_exchange_weak(current, current + 1, std::memory_order_acquire))
+                break;
+            std::this_thread::yield();
+            current = sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return current;
+    }
+
+    void end_write(uint64_t current)
+    {
+        sequence.store(current + 2, std::memory_order_release);
+    }
+};
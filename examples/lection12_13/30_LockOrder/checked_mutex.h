@@ -0,0 +1,399 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <ostream>
+
+/**
+ * checked_mutex - мьютекс с проверкой порядка захвата и статистикой.
+ *
+ * Если определен макрос LOCK_ORDER_CHECK, каждый захват записывается в
+ * глобальный граф "мьютекс A был захвачен, пока удерживался B" (ребро B → A).
+ * Если новое ребро замыкает цикл, значит в программе есть два пути, которые
+ * захватывают мьютексы в разном порядке, - это потенциальный deadlock, даже
+ * если в этот раз потоки разминулись и ничего не зависло. Цикл печатается
+ * вместе с контекстом: какие мьютексы держал поток и стек вызовов.
+ *
+ * Дополнительно для каждого мьютекса считаются захваты, захваты с ожиданием,
+ * суммарное время ожидания и удержания.
+ *
+ * Если определен только LOCK_STATS, граф не строится, а считается одна
+ * статистика: relaxed-счетчики в самом мьютексе и два чтения часов на
+ * захват, без глобальных блокировок. Этот режим можно оставить в боевой
+ * сборке, чтобы искать "горячие" мьютексы под реальной нагрузкой.
+ *
+ * Без LOCK_ORDER_CHECK и LOCK_STATS checked_mutex - это просто std::mutex
+ * с именем, которое никуда не сохраняется, т.е. накладные расходы нулевые.
+ */
+
+#if !defined(LOCK_ORDER_CHECK) && !defined(LOCK_STATS)
+
+class checked_mutex : public std::mutex
+{
+public:
+    explicit checked_mutex(const char * = "") {}
+};
+
+namespace lock_order
+{
+    inline void print_statistics(std::ostream &) {}
+    inline size_t cycles_detected() { return 0; }
+    template <class F>
+    inline void set_handler(F &&) {}
+}
+
+#else
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define LOCK_ORDER_HAS_BACKTRACE
+#endif
+
+class checked_mutex;
+
+namespace lock_order
+{
+    /**
+     * Статистика одного мьютекса. Обновляется атомарно без блокировок.
+     */
+    struct statistics
+    {
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> contended{0};     // Сколько раз пришлось ждать
+        std::atomic<uint64_t> wait_ns{0};
+        std::atomic<uint64_t> hold_ns{0};
+        std::atomic<uint64_t> max_hold_ns{0};
+    };
+
+    /**
+     * Ребро графа порядка захвата с контекстом первого появления
+     */
+    struct edge_context
+    {
+        std::string held;     // Какие мьютексы держал поток
+        std::string stack;    // Стек вызовов в момент захвата
+        std::thread::id thread;
+    };
+
+    /**
+     * Адреса возврата в момент захвата. Снимаются прямо в checked_mutex::lock,
+     * который никогда не встраивается: кадр 0 - сам lock, дальше - код,
+     * захватывающий мьютекс. Фиксированное число "служебных" кадров в
+     * Release не работает - компилятор встраивает их в вызывающий код.
+     */
+    struct stack_trace
+    {
+        void *frames[32];
+        int count = 0;
+    };
+
+    inline std::string format_stack(const stack_trace &trace)
+    {
+#ifdef LOCK_ORDER_HAS_BACKTRACE
+        if (trace.count <= 1)
+            return "        (стек вызовов пуст)\n";
+        // Имена известны только экспортированным функциям (-rdynamic); сырой
+        // адрес в квадратных скобках можно расшифровать через addr2line
+        char **symbols = backtrace_symbols(trace.frames, trace.count);
+        std::ostringstream out;
+        for (int i = 1; i < trace.count; ++i)
+        {
+            out << "        #" << i - 1 << " ";
+            if (symbols)
+                out << symbols[i] << "\n";
+            else
+                out << "[" << trace.frames[i] << "]\n";
+        }
+        free(symbols);
+        return out.str();
+#else
+        (void)trace;
+        return "        (стек вызовов недоступен на этой платформе)\n";
+#endif
+    }
+
+    /**
+     * Глобальный реестр: граф порядка захвата и имена мьютексов.
+     * Сам защищен обычным std::mutex - режим проверки предназначен для
+     * отладки и нагрузочных тестов, а не для боевой сборки.
+     */
+    class registry
+    {
+    private:
+        std::mutex mtx;
+        std::map<uint64_t, std::string> names;
+        std::map<uint64_t, std::map<uint64_t, edge_context>> graph; // from -> (to -> контекст)
+        std::map<uint64_t, statistics *> stats;
+        std::set<std::pair<uint64_t, uint64_t>> reported;
+        std::atomic<uint64_t> next_id{1};
+        std::atomic<size_t> cycles{0};
+        std::function<void(const std::string &)> handler =
+            [](const std::string &report) { std::cerr << report << std::flush; };
+
+        // Поиск пути from → ... → to в графе (обход в глубину)
+        bool find_path(uint64_t from, uint64_t to, std::vector<uint64_t> &path, std::set<uint64_t> &visited)
+        {
+            path.push_back(from);
+            if (from == to)
+                return true;
+            visited.insert(from);
+            auto it = graph.find(from);
+            if (it != graph.end())
+                for (auto &[next, ctx] : it->second)
+                    if (!visited.count(next) && find_path(next, to, path, visited))
+                        return true;
+            path.pop_back();
+            return false;
+        }
+
+    public:
+        static registry &instance()
+        {
+            static registry r;
+            return r;
+        }
+
+        uint64_t add(const char *name, statistics *s)
+        {
+            uint64_t id = next_id++;
+            std::lock_guard<std::mutex> lock(mtx);
+            names[id] = name;
+            stats[id] = s;
+            return id;
+        }
+
+        void remove(uint64_t id)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            graph.erase(id);
+            for (auto &[from, edges] : graph)
+                edges.erase(id);
+            stats.erase(id);
+            // Имя оставляем: оно может понадобиться в уже сохраненных отчетах
+        }
+
+        void set_handler(std::function<void(const std::string &)> h)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            handler = std::move(h);
+        }
+
+        size_t cycles_detected() const { return cycles.load(); }
+
+        /**
+         * Регистрирует ребро held → acquired. Если обратный путь уже есть -
+         * сообщает о потенциальном deadlock.
+         */
+        void add_edge(uint64_t held, uint64_t acquired, const std::vector<uint64_t> &held_stack, const stack_trace &trace)
+        {
+            std::string report;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                auto &edges = graph[held];
+                if (edges.count(acquired))
+                    return;
+
+                std::ostringstream held_names;
+                for (uint64_t id : held_stack)
+                    held_names << names[id] << " ";
+                edge_context ctx{held_names.str(), format_stack(trace), std::this_thread::get_id()};
+
+                std::vector<uint64_t> path;
+                std::set<uint64_t> visited;
+                if (find_path(acquired, held, path, visited) && reported.insert({held, acquired}).second)
+                {
+                    ++cycles;
+                    std::ostringstream out;
+                    out << "=== ПОТЕНЦИАЛЬНЫЙ DEADLOCK: цикл в порядке захвата мьютексов ===\n";
+                    out << "Поток " << ctx.thread << " захватывает " << names[acquired]
+                        << ", удерживая [ " << ctx.held << "]\n"
+                        << ctx.stack;
+                    out << "Но ранее был установлен обратный порядок:\n";
+                    for (size_t i = 0; i + 1 < path.size(); ++i)
+                    {
+                        const edge_context &prev = graph[path[i]][path[i + 1]];
+                        out << "  " << names[path[i]] << " → " << names[path[i + 1]]
+                            << " (поток " << prev.thread << ", удерживал [ " << prev.held << "])\n"
+                            << prev.stack;
+                    }
+                    report = out.str();
+                }
+                edges.emplace(acquired, std::move(ctx));
+            }
+            if (!report.empty())
+                handler(report);
+        }
+
+        void print_statistics(std::ostream &out)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            std::vector<std::pair<uint64_t, statistics *>> sorted(stats.begin(), stats.end());
+            std::sort(sorted.begin(), sorted.end(), [](auto &a, auto &b)
+                      { return a.second->wait_ns > b.second->wait_ns; });
+
+            out << std::left << std::setw(20) << "mutex"
+                << std::right << std::setw(14) << "acquisitions"
+                << std::setw(12) << "contended"
+                << std::setw(14) << "wait, us"
+                << std::setw(14) << "hold, us"
+                << std::setw(14) << "max hold, us" << "\n";
+            for (auto &[id, s] : sorted)
+                out << std::left << std::setw(20) << names[id]
+                    << std::right << std::setw(14) << s->acquisitions.load()
+                    << std::setw(12) << s->contended.load()
+                    << std::setw(14) << s->wait_ns.load() / 1000
+                    << std::setw(14) << s->hold_ns.load() / 1000
+                    << std::setw(14) << s->max_hold_ns.load() / 1000 << "\n";
+        }
+    };
+
+    /**
+     * Мьютексы, которые сейчас держит текущий поток (только для графа)
+     */
+    inline std::vector<uint64_t> &held_by_this_thread()
+    {
+        thread_local std::vector<uint64_t> held;
+        return held;
+    }
+
+    inline void print_statistics(std::ostream &out) { registry::instance().print_statistics(out); }
+    inline size_t cycles_detected() { return registry::instance().cycles_detected(); }
+    inline void set_handler(std::function<void(const std::string &)> h) { registry::instance().set_handler(std::move(h)); }
+}
+
+#ifdef LOCK_ORDER_CHECK
+// Стек для отчета снимается в lock(), поэтому он не встраивается
+#define LOCK_ORDER_NOINLINE [[gnu::noinline]]
+#else
+#define LOCK_ORDER_NOINLINE
+#endif
+
+class checked_mutex
+{
+private:
+#ifdef LOCK_ORDER_CHECK
+    static constexpr uint32_t hold_sample_period = 1;
+#else
+    // Чтение часов стоит десятки наносекунд, поэтому в режиме LOCK_STATS время
+    // удержания замеряется у каждого 16-го захвата в потоке и умножается на 16
+    static constexpr uint32_t hold_sample_period = 16;
+#endif
+
+    std::mutex mtx;
+    lock_order::statistics stats;
+    uint64_t id;
+    // Пишет и читает только владелец мьютекса
+    std::chrono::steady_clock::time_point locked_at;
+    bool hold_sampled = false;
+
+#ifdef LOCK_ORDER_CHECK
+    // Встраивается в lock(), чтобы backtrace начинался с кадра lock()
+    [[gnu::always_inline]] void before_lock()
+    {
+        auto &held = lock_order::held_by_this_thread();
+        if (held.empty())
+            return;
+
+        // Уже виденные этим потоком ребра не проверяем повторно - глобальный реестр не трогаем
+        thread_local std::set<std::pair<uint64_t, uint64_t>> known;
+        std::vector<uint64_t> held_ids;
+        for (uint64_t from : held)
+            if (known.insert({from, id}).second)
+                held_ids.push_back(from);
+        if (held_ids.empty())
+            return;
+
+        lock_order::stack_trace trace;
+#ifdef LOCK_ORDER_HAS_BACKTRACE
+        trace.count = backtrace(trace.frames, 32);
+#endif
+        for (uint64_t from : held_ids)
+            lock_order::registry::instance().add_edge(from, id, held, trace);
+    }
+#endif
+
+    void after_lock()
+    {
+        stats.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        thread_local uint32_t acquisitions_in_thread = 0;
+        hold_sampled = ++acquisitions_in_thread % hold_sample_period == 0;
+        if (hold_sampled)
+            locked_at = std::chrono::steady_clock::now();
+#ifdef LOCK_ORDER_CHECK
+        lock_order::held_by_this_thread().push_back(id);
+#endif
+    }
+
+public:
+    explicit checked_mutex(const char *name = "mutex")
+        : id(lock_order::registry::instance().add(name, &stats)) {}
+
+    ~checked_mutex() { lock_order::registry::instance().remove(id); }
+
+    checked_mutex(const checked_mutex &) = delete;
+    checked_mutex &operator=(const checked_mutex &) = delete;
+
+    LOCK_ORDER_NOINLINE void lock()
+    {
+#ifdef LOCK_ORDER_CHECK
+        before_lock();
+#endif
+        if (mtx.try_lock())
+        {
+            after_lock();
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        mtx.lock();
+        stats.contended.fetch_add(1, std::memory_order_relaxed);
+        stats.wait_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count(),
+                                std::memory_order_relaxed);
+        after_lock();
+    }
+
+    // try_lock не может заблокироваться, поэтому ребра графа не добавляет
+    bool try_lock()
+    {
+        if (!mtx.try_lock())
+            return false;
+        after_lock();
+        return true;
+    }
+
+    void unlock()
+    {
+        if (hold_sampled)
+        {
+            uint64_t hold = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - locked_at)
+                                .count();
+            stats.hold_ns.fetch_add(hold * hold_sample_period, std::memory_order_relaxed);
+            uint64_t max = stats.max_hold_ns.load(std::memory_order_relaxed);
+            while (hold > max && !stats.max_hold_ns.compare_exchange_weak(max, hold, std::memory_order_relaxed))
+                ;
+        }
+#ifdef LOCK_ORDER_CHECK
+        auto &held = lock_order::held_by_this_thread();
+        auto it = std::find(held.rbegin(), held.rend(), id);
+        if (it != held.rend())
+            held.erase(std::next(it).base());
+#endif
+        mtx.unlock();
+    }
+};
+
+#endif
@@ -0,0 +1,114 @@
+// Закомментируйте, чтобы checked_mutex превратился в обычный std::mutex.
+// Цель 30_LockOrder_Stats собирается с LOCK_STATS: только статистика, без графа
+#ifndef LOCK_STATS
+#define LOCK_ORDER_CHECK
+#endif
+
+#include <iostream>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <sstream>
+
+#include "checked_mutex.h"
+
+struct print : std::stringstream
+{
+    ~print()
+    {
+        static std::mutex mtx;
+        std::lock_guard<std::mutex> lck(mtx);
+        std::cout << this->str();
+        std::cout.flush();
+    }
+};
+
+checked_mutex resource_A("resource_A");
+checked_mutex resource_B("resource_B");
+checked_mutex foo("foo");
+checked_mutex bar("bar");
+
+// Те же функции, что и в 17_DeadLock2: мьютексы захватываются в разном порядке
+void DeadLockA()
+{
+    std::lock_guard<checked_mutex> lockA(resource_A);
+    std::lock_guard<checked_mutex> lockB(resource_B);
+    print() << "FooA: ResourceA и ResourceB захвачены" << std::endl;
+}
+
+void DeadLockB()
+{
+    std::lock_guard<checked_mutex> lockB(resource_B);
+    std::lock_guard<checked_mutex> lockA(resource_A);
+    print() << "FooB: ResourceB и ResourceA захвачены" << std::endl;
+}
+
+// Исправленный вариант из 15_Deadlock: std::lock захватывает оба мьютекса сразу
+void task_a()
+{
+    std::lock(foo, bar);
+    std::unique_lock<checked_mutex> lck1(foo, std::adopt_lock);
+    std::unique_lock<checked_mutex> lck2(bar, std::adopt_lock);
+    print() << "task a" << std::endl;
+}
+
+void task_b()
+{
+    std::unique_lock<checked_mutex> lck1(bar, std::defer_lock);
+    std::unique_lock<checked_mutex> lck2(foo, std::defer_lock);
+    std::lock(lck1, lck2);
+    print() << "task b" << std::endl;
+}
+
+template <class Mutex>
+long long measure(Mutex &mtx, int threads_count, int iterations)
+{
+    long counter = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+        threads.emplace_back([&]()
+                             {
+            for (int i = 0; i < iterations; ++i) {
+                std::lock_guard<Mutex> lock(mtx);
+                ++counter;
+            } });
+    for (auto &t : threads)
+        t.join();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    std::cout << "=== 1. Разный порядок захвата (17_DeadLock2) ===" << std::endl;
+    std::cout << "Потоки запускаются по очереди, поэтому программа не зависает," << std::endl;
+#ifdef LOCK_ORDER_CHECK
+    std::cout << "но детектор все равно находит цикл в порядке захвата:" << std::endl;
+#else
+    std::cout << "(сборка LOCK_STATS: граф порядка захвата не строится)" << std::endl;
+#endif
+    std::thread t1(DeadLockA);
+    t1.join();
+    std::thread t2(DeadLockB);
+    t2.join();
+
+    std::cout << "\n=== 2. std::lock (15_Deadlock) ===" << std::endl;
+    std::thread t3(task_a);
+    std::thread t4(task_b);
+    t3.join();
+    t4.join();
+    std::cout << "Найдено циклов: " << lock_order::cycles_detected() << std::endl;
+
+    std::cout << "\n=== 3. Накладные расходы и статистика ===" << std::endl;
+    const int iterations = 200000;
+    std::mutex plain;
+    checked_mutex hot("hot_counter");
+    std::cout << "std::mutex:    " << measure(plain, 4, iterations) << " мкс" << std::endl;
+    std::cout << "checked_mutex: " << measure(hot, 4, iterations) << " мкс" << std::endl;
+
+    std::cout << std::endl;
+    lock_order::print_statistics(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * Хеш-таблица для совместного использования несколькими потоками.
+ *
+ * std::unordered_map под одним мьютексом (как std::stack в thread_safe_stack
+ * из 18_Stack) пропускает в каждый момент только один поток, даже если
+ * потоки работают с разными ключами. Здесь таблица разбита на STRIPES
+ * независимых частей ("полос", lock striping), у каждой свой мьютекс
+ * (по умолчанию std::shared_mutex) и свой std::unordered_map. Ключ попадает в полосу по
+ * хешу, поэтому потоки с разными ключами почти всегда берут разные мьютексы:
+ * - чтение (find, contains, cvisit) - shared_lock своей полосы, читатели
+ *   одной полосы не мешают друг другу;
+ * - запись (insert_or_assign, erase, visit) - unique_lock только своей
+ *   полосы, остальные полосы в это время доступны.
+ * Каждая полоса в своей кэш-линии (alignas(64)), а рост таблицы идет по
+ * полосам - глобальной блокировки на перехеширование нет.
+ *
+ * Ссылки на элементы наружу не отдаются: после снятия блокировки элемент
+ * может быть удален другим потоком. Поэтому find возвращает копию, а для
+ * работы с элементом на месте есть visit/cvisit - функция вызывается под
+ * блокировкой полосы.
+ *
+ * @tparam STRIPES - количество полос (степень двойки, обычно в несколько раз больше числа ядер)
+ * @tparam Mutex - мьютекс полосы: std::shared_mutex (параллельное чтение) или
+ *                 std::mutex (дешевле, если читатели одной полосы редко встречаются)
+ */
+template <class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+          size_t STRIPES = 64, class Mutex = std::shared_mutex>
+class concurrent_hash_map
+{
+private:
+    static_assert(std::has_single_bit(STRIPES), "STRIPES должно быть степенью двойки");
+
+    // Мьютекс без lock_shared (std::mutex) - читатели одной полосы идут по очереди
+    using read_lock = std::conditional_t<requires(Mutex &m) { m.lock_shared(); },
+                                         std::shared_lock<Mutex>, std::unique_lock<Mutex>>;
+    using write_lock = std::lock_guard<Mutex>;
+
+    struct alignas(64) stripe
+    {
+        mutable Mutex mtx;
+        std::unordered_map<Key, T, Hash, KeyEqual> data;
+    };
+
+    std::array<stripe, STRIPES> stripes;
+    Hash hash_function;
+
+    /**
+     * Полоса по старшим битам перемешанного хеша (фибоначчиево хеширование):
+     * младшие биты хеша использует сам unordered_map внутри полосы,
+     * а std::hash<int> - тождественная функция
+     */
+    stripe &stripe_for(const Key &key)
+    {
+        if constexpr (STRIPES == 1)
+        {
+            return stripes[0]; // Сдвиг на 64 бита был бы неопределенным поведением
+        }
+        else
+        {
+            constexpr int SHIFT = 64 - std::countr_zero(STRIPES);
+            uint64_t mixed = static_cast<uint64_t>(hash_function(key)) * 0x9E3779B97F4A7C15ULL;
+            return stripes[static_cast<size_t>(mixed >> SHIFT)];
+        }
+    }
+
+    const stripe &stripe_for(const Key &key) const
+    {
+        return const_cast<concurrent_hash_map *>(this)->stripe_for(key);
+    }
+
+public:
+    concurrent_hash_map() = default;
+    concurrent_hash_map(const concurrent_hash_map &) = delete;
+    concurrent_hash_map &operator=(const concurrent_hash_map &) = delete;
+
+    /**
+     * Копия значения по ключу
+     */
+    std::optional<T> find(const Key &key) const
+    {
+        const stripe &s = stripe_for(key);
+        read_lock lock(s.mtx);
+        auto it = s.data.find(key);
+        if (it == s.data.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    bool contains(const Key &key) const
+    {
+        const stripe &s = stripe_for(key);
+        read_lock lock(s.mtx);
+        return s.data.find(key) != s.data.end();
+    }
+
+    /**
+     * Вставка, если ключа еще нет
+     * @return true, если элемент вставлен
+     */
+    template <class... Args>
+    bool try_emplace(const Key &key, Args &&...args)
+    {
+        stripe &s = stripe_for(key);
+        write_lock lock(s.mtx);
+        return s.data.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * Вставка или замена значения
+     * @return true, если элемент вставлен, false - если заменен
+     */
+    template <class M>
+    bool insert_or_assign(const Key &key, M &&value)
+    {
+        stripe &s = stripe_for(key);
+        write_lock lock(s.mtx);
+        return s.data.insert_or_assign(key, std::forward<M>(value)).second;
+    }
+
+    bool erase(const Key &key)
+    {
+        stripe &s = stripe_for(key);
+        write_lock lock(s.mtx);
+        return s.data.erase(key) != 0;
+    }
+
+    /**
+     * Изменение элемента на месте: f(T &) вызывается под исключительной
+     * блокировкой полосы. Чтение-изменение-запись (например, счетчик)
+     * выполняется атомарно
+     * @return true, если ключ найден
+     */
+    template <class F>
+    bool visit(const Key &key, F &&f)
+    {
+        stripe &s = stripe_for(key);
+        write_lock lock(s.mtx);
+        auto it = s.data.find(key);
+        if (it == s.data.end())
+            return false;
+        f(it->second);
+        return true;
+    }
+
+    /**
+     * Чтение элемента на месте без копирования: f(const T &) вызывается
+     * под разделяемой блокировкой полосы
+     * @return true, если ключ найден
+     */
+    template <class F>
+    bool cvisit(const Key &key, F &&f) const
+    {
+        const stripe &s = stripe_for(key);
+        read_lock lock(s.mtx);
+        auto it = s.data.find(key);
+        if (it == s.data.end())
+            return false;
+        f(std::as_const(it->second));
+        return true;
+    }
+
+    /**
+     * Обход всех элементов: f(const Key &, const T &). Полосы блокируются
+     * по очереди, поэтому обход не является снимком всей таблицы на один
+     * момент времени - параллельные изменения в уже пройденных полосах
+     * не видны
+     */
+    template <class F>
+    void cvisit_all(F &&f) const
+    {
+        for (const stripe &s : stripes)
+        {
+            read_lock lock(s.mtx);
+            for (const auto &[key, value] : s.data)
+                f(key, value);
+        }
+    }
+
+    /**
+     * Количество элементов. При параллельных изменениях - приблизительное
+     */
+    size_t size() const
+    {
+        size_t total = 0;
+        for (const stripe &s : stripes)
+        {
+            read_lock lock(s.mtx);
+            total += s.data.size();
+        }
+        return total;
+    }
+
+    /**
+     * Резерв под count элементов, поровну на полосу
+     */
+    void reserve(size_t count)
+    {
+        for (stripe &s : stripes)
+        {
+            write_lock lock(s.mtx);
+            s.data.reserve(count / STRIPES + 1);
+        }
+    }
+
+    void clear()
+    {
+        for (stripe &s : stripes)
+        {
+            write_lock lock(s.mtx);
+            s.data.clear();
+        }
+    }
+};
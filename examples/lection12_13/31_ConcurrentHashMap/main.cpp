@@ -0,0 +1,196 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <optional>
+#include <unordered_map>
+
+#include "concurrent_hash_map.h"
+
+/**
+ * std::unordered_map под одним мьютексом - так же, как thread_safe_stack
+ * из 18_Stack защищает std::stack. Для std::shared_mutex чтение идет
+ * под shared_lock (как в 16_SharedLock)
+ */
+template <class Mutex>
+class locked_map
+{
+private:
+    mutable Mutex mtx;
+    std::unordered_map<long, long> data;
+
+public:
+    std::optional<long> find(long key) const
+    {
+        std::shared_lock<Mutex> lock(mtx);
+        auto it = data.find(key);
+        if (it == data.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    bool insert_or_assign(long key, long value)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return data.insert_or_assign(key, value).second;
+    }
+
+    bool erase(long key)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return data.erase(key) != 0;
+    }
+
+    void reserve(size_t count)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        data.reserve(count);
+    }
+};
+
+/**
+ * std::shared_lock требует lock_shared(). Для обычного std::mutex
+ * "разделяемая" блокировка - та же исключительная
+ */
+struct plain_mutex : std::mutex
+{
+    void lock_shared() { lock(); }
+    void unlock_shared() { unlock(); }
+};
+
+constexpr long KEYS = 1 << 18;
+
+/**
+ * Быстрый генератор псевдослучайных чисел (xorshift) - у каждого потока свой
+ */
+struct xorshift
+{
+    uint64_t state;
+
+    uint64_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+/**
+ * Запускает threads потоков на duration. Каждая операция - поиск случайного
+ * ключа с вероятностью read_percent, иначе поровну insert_or_assign и erase.
+ * @return операций в миллисекунду (всех потоков вместе)
+ */
+template <class Map>
+double run(int threads_count, int read_percent, std::chrono::milliseconds duration)
+{
+    Map map;
+    map.reserve(KEYS);
+    for (long key = 0; key < KEYS; key += 2)
+        map.insert_or_assign(key, key);
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<long> total_operations{0};
+    std::atomic<long> checksum{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threads_count; ++i)
+        threads.emplace_back([&, i]()
+                             {
+            xorshift random{0x9E3779B97F4A7C15ULL * (i + 1)};
+            long operations = 0, found = 0;
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                uint64_t r = random.next();
+                long key = long(r >> 20) % KEYS;
+                if (long(r % 100) < read_percent) {
+                    if (auto value = map.find(key)) found += *value;
+                } else if (r & 128) {
+                    map.insert_or_assign(key, key);
+                } else {
+                    map.erase(key);
+                }
+                ++operations;
+            }
+            total_operations += operations;
+            checksum += found; });
+
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto &t : threads)
+        t.join();
+
+    return double(total_operations.load()) / duration.count();
+}
+
+void print_table(int read_percent, std::chrono::milliseconds duration)
+{
+    std::cout << "Чтение " << read_percent << "%, запись " << 100 - read_percent << "% (операций в миллисекунду):" << std::endl;
+    std::cout << std::setw(8) << "threads"
+              << std::setw(16) << "std::mutex"
+              << std::setw(20) << "std::shared_mutex"
+              << std::setw(22) << "striped shared_mutex"
+              << std::setw(16) << "striped mutex" << std::endl;
+
+    for (int threads = 1; threads <= 64; threads *= 2)
+    {
+        double plain = run<locked_map<plain_mutex>>(threads, read_percent, duration);
+        double shared = run<locked_map<std::shared_mutex>>(threads, read_percent, duration);
+        double striped_shared = run<concurrent_hash_map<long, long>>(threads, read_percent, duration);
+        double striped_plain = run<concurrent_hash_map<long, long, std::hash<long>, std::equal_to<long>, 64, std::mutex>>(
+            threads, read_percent, duration);
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(16) << long(plain)
+                  << std::setw(20) << long(shared)
+                  << std::setw(22) << long(striped_shared)
+                  << std::setw(16) << long(striped_plain) << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::chrono::milliseconds duration(argc > 1 ? std::stoi(argv[1]) : 200);
+
+    std::cout << "=== CONCURRENT_HASH_MAP: ПОЛОСЫ БЛОКИРОВОК ПРОТИВ ОДНОГО МЬЮТЕКСА ===" << std::endl;
+    std::cout << "Аппаратных потоков: " << std::thread::hardware_concurrency()
+              << ", длительность замера: " << duration.count() << " мс" << std::endl
+              << std::endl;
+
+    // Интерфейс: find, insert_or_assign, erase, visit/cvisit
+    {
+        concurrent_hash_map<std::string, int> word_count;
+        std::vector<std::thread> counters;
+        for (int i = 0; i < 4; ++i)
+            counters.emplace_back([&word_count]()
+                                  {
+                for (int n = 0; n < 1000; ++n) {
+                    // visit - чтение-изменение-запись под блокировкой полосы
+                    if (!word_count.visit("alpha", [](int &count) { ++count; }))
+                        if (!word_count.try_emplace("alpha", 1))
+                            word_count.visit("alpha", [](int &count) { ++count; });
+                } });
+        for (auto &t : counters)
+            t.join();
+
+        word_count.insert_or_assign("bravo", 7);
+        word_count.erase("bravo");
+        std::cout << "4 потока x 1000 увеличений счетчика \"alpha\": " << word_count.find("alpha").value_or(0)
+                  << ", \"bravo\" после erase: " << (word_count.contains("bravo") ? "есть" : "нет") << std::endl
+                  << std::endl;
+    }
+
+    print_table(95, duration);
+    print_table(50, duration);
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <queue>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include "ring_buffer_queue.h"
+
+/**
+ * std::queue под мьютексом - так очередь событий устроена в FightManager
+ * (lab_07) и EventLoop (23_CustomAsync). Очередь не ограничена, поэтому
+ * try_push всегда успешен
+ */
+template <class T>
+class mutex_queue
+{
+private:
+    std::mutex mtx;
+    std::queue<T> data;
+
+public:
+    explicit mutex_queue(size_t) {} // Емкость для единообразия с кольцевыми очередями, не ограничивает
+
+    bool try_push(const T &value)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        data.push(value);
+        return true;
+    }
+
+    bool try_pop(T &value)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (data.empty())
+            return false;
+        value = std::move(data.front());
+        data.pop();
+        return true;
+    }
+};
+
+/**
+ * Дополнение пробелами до width символов: setw считает байты, а кириллица
+ * в UTF-8 занимает два байта на символ
+ */
+std::string padded(const std::string &text, size_t width)
+{
+    size_t symbols = 0;
+    for (unsigned char byte : text)
+        symbols += (byte & 0xC0) != 0x80;
+    return text + std::string(width > symbols ? width - symbols : 0, ' ');
+}
+
+constexpr size_t CAPACITY = 1024;
+constexpr size_t BATCH = 64;
+
+/**
+ * Производители передают потребителям items чисел: каждый производитель
+ * свою долю, каждый потребитель забирает такую же долю. Если очередь
+ * полна (пуста), поток уступает процессор (yield).
+ *
+ * @param batched - пакетные push_batch/pop_batch по BATCH элементов
+ * @return время в миллисекундах; в checksum - сумма принятых чисел
+ */
+template <class Queue>
+double run(Queue &queue, int producers, int consumers, size_t items, bool batched, long long &checksum)
+{
+    std::atomic<bool> start{false};
+    std::atomic<long long> total{0};
+    std::vector<std::thread> threads;
+
+    size_t per_producer = items / producers;
+    size_t per_consumer = items / consumers;
+
+    for (int p = 0; p < producers; ++p)
+        threads.emplace_back([&, p]()
+                             {
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            long long value = static_cast<long long>(p * per_producer);
+            long long last = value + static_cast<long long>(per_producer);
+            std::vector<long long> batch(BATCH);
+            while (value < last) {
+                if constexpr (requires { queue.push_batch(batch.begin(), BATCH); }) {
+                    if (batched) {
+                        size_t count = std::min<size_t>(BATCH, size_t(last - value));
+                        for (size_t i = 0; i < count; ++i)
+                            batch[i] = value + static_cast<long long>(i);
+                        size_t pushed = 0;
+                        while (pushed < count) {
+                            size_t accepted = queue.push_batch(batch.begin() + pushed, count - pushed);
+                            if (accepted == 0)
+                                std::this_thread::yield();
+                            pushed += accepted;
+                        }
+                        value += static_cast<long long>(count);
+                        continue;
+                    }
+                }
+                while (!queue.try_push(value))
+                    std::this_thread::yield();
+                ++value;
+            } });
+
+    for (int c = 0; c < consumers; ++c)
+        threads.emplace_back([&]()
+                             {
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            long long sum = 0;
+            size_t received = 0;
+            std::vector<long long> batch(BATCH);
+            while (received < per_consumer) {
+                if constexpr (requires { queue.pop_batch(batch.begin(), BATCH); }) {
+                    if (batched) {
+                        size_t taken = queue.pop_batch(batch.begin(), std::min(BATCH, per_consumer - received));
+                        if (taken == 0)
+                            std::this_thread::yield();
+                        for (size_t i = 0; i < taken; ++i)
+                            sum += batch[i];
+                        received += taken;
+                        continue;
+                    }
+                }
+                long long value;
+                if (queue.try_pop(value)) {
+                    sum += value;
+                    ++received;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            total += sum; });
+
+    auto start_time = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &t : threads)
+        t.join();
+    auto end_time = std::chrono::steady_clock::now();
+
+    checksum = total.load();
+    return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+/**
+ * Один замер: время, пропускная способность и проверка суммы
+ */
+template <class Queue>
+void measure(const char *name, int producers, int consumers, size_t items, bool batched)
+{
+    Queue queue(CAPACITY);
+    long long checksum = 0;
+    double ms = run(queue, producers, consumers, items, batched, checksum);
+    long long expected = static_cast<long long>(items) * static_cast<long long>(items - 1) / 2;
+
+    std::cout << "   " << padded(name, 28) << std::fixed << std::setprecision(1)
+              << std::setw(8) << ms << " мс"
+              << std::setw(10) << double(items) / ms / 1000.0 << " млн/с"
+              << (checksum == expected ? "" : "  ОШИБКА: сумма не совпала") << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t items = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    items -= items % (16 * BATCH); // Поровну на каждого производителя и потребителя
+
+    std::cout << "=== ОГРАНИЧЕННАЯ ОЧЕРЕДЬ НА КОЛЬЦЕВОМ БУФЕРЕ ===" << std::endl;
+    std::cout << "Аппаратных потоков: " << std::thread::hardware_concurrency()
+              << ", элементов: " << items << ", емкость: " << CAPACITY << ", пакет: " << BATCH << std::endl;
+
+    // Интерфейс
+    {
+        spsc_queue<std::string> messages(3); // Емкость округляется до 4
+        messages.try_push("first");
+        messages.try_push("second");
+        std::vector<std::string> more = {"third", "fourth", "fifth"};
+        size_t accepted = messages.push_batch(more.begin(), more.size());
+        std::string message;
+        messages.try_pop(message);
+        std::cout << std::endl
+                  << "spsc_queue<std::string>(3): емкость " << messages.capacity()
+                  << ", из пакета в 3 элемента поместилось " << accepted << ", первый элемент - " << message << std::endl;
+    }
+
+    struct configuration
+    {
+        int producers;
+        int consumers;
+    };
+
+    for (configuration config : {configuration{1, 1}, configuration{4, 4}, configuration{16, 16}})
+    {
+        std::cout << std::endl
+                  << config.producers << " производитель(ей) / " << config.consumers << " потребитель(ей):" << std::endl;
+        measure<mutex_queue<long long>>("std::queue + std::mutex", config.producers, config.consumers, items, false);
+        if (config.producers == 1 && config.consumers == 1)
+        {
+            measure<spsc_queue<long long>>("spsc_queue", 1, 1, items, false);
+            measure<spsc_queue<long long>>("spsc_queue, пакеты", 1, 1, items, true);
+        }
+        measure<mpmc_queue<long long>>("mpmc_queue", config.producers, config.consumers, items, false);
+        measure<mpmc_queue<long long>>("mpmc_queue, пакеты", config.producers, config.consumers, items, true);
+    }
+
+    return 0;
+}
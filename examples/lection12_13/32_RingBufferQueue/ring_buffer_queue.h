@@ -0,0 +1,379 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Размер кэш-линии: индексы производителя и потребителя лежат в разных
+ * линиях, иначе запись одного постоянно выбивала бы линию у другого
+ * (false sharing)
+ */
+constexpr size_t cache_line_size = 64;
+
+/**
+ * Ограниченная очередь на кольцевом буфере: один производитель, один
+ * потребитель (SPSC).
+ *
+ * std::queue поверх std::deque (11_Queue) под мьютексом выделяет память
+ * блоками по мере роста и на каждую операцию захватывает мьютекс. Здесь
+ * память выделяется один раз, а синхронизация - две атомарные переменные:
+ * - tail пишет только производитель, head - только потребитель;
+ * - каждый из них держит копию чужого индекса (cached_head / cached_tail)
+ *   и перечитывает оригинал, только когда по копии очередь полна или пуста.
+ * Емкость - степень двойки: позиция в буфере - index & mask, а индексы
+ * растут монотонно (size_t не переполнится за время жизни программы).
+ *
+ * try_push/try_pop не ждут: при полной (пустой) очереди возвращают false.
+ * Пакетные push_batch/pop_batch публикуют сразу несколько элементов одной
+ * атомарной записью.
+ */
+template <class T>
+class spsc_queue
+{
+private:
+    const size_t capacity_value;
+    const size_t mask;
+    T *slots;
+
+    alignas(cache_line_size) std::atomic<size_t> head{0}; // Следующий элемент для чтения
+    size_t cached_tail = 0;                                // Копия tail у потребителя
+
+    alignas(cache_line_size) std::atomic<size_t> tail{0}; // Следующая свободная ячейка
+    size_t cached_head = 0;                                // Копия head у производителя
+
+    /**
+     * Свободное место с точки зрения производителя. Настоящий head
+     * перечитывается, только если по копии места меньше wanted
+     */
+    size_t free_space(size_t position, size_t wanted)
+    {
+        if (capacity_value - (position - cached_head) < wanted)
+            cached_head = head.load(std::memory_order_acquire);
+        return capacity_value - (position - cached_head);
+    }
+
+    /** Готовые элементы с точки зрения потребителя */
+    size_t ready_count(size_t position, size_t wanted)
+    {
+        if (cached_tail - position < wanted)
+            cached_tail = tail.load(std::memory_order_acquire);
+        return cached_tail - position;
+    }
+
+public:
+    /**
+     * @param capacity - емкость, округляется вверх до степени двойки
+     */
+    explicit spsc_queue(size_t capacity)
+        : capacity_value(std::bit_ceil(std::max<size_t>(capacity, 2))),
+          mask(capacity_value - 1),
+          slots(std::allocator<T>().allocate(capacity_value))
+    {
+    }
+
+    spsc_queue(const spsc_queue &) = delete;
+    spsc_queue &operator=(const spsc_queue &) = delete;
+
+    ~spsc_queue()
+    {
+        for (size_t position = head.load(); position != tail.load(); ++position)
+            std::destroy_at(slots + (position & mask));
+        std::allocator<T>().deallocate(slots, capacity_value);
+    }
+
+    template <class... Args>
+    bool try_emplace(Args &&...args)
+    {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (free_space(position, 1) == 0)
+            return false;
+        ::new (static_cast<void *>(slots + (position & mask))) T(std::forward<Args>(args)...);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T &value) { return try_emplace(value); }
+    bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+    bool try_pop(T &value)
+    {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (ready_count(position, 1) == 0)
+            return false;
+        T &slot = slots[position & mask];
+        value = std::move(slot);
+        std::destroy_at(&slot);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Добавление до count элементов из first одной публикацией
+     * @return сколько элементов поместилось
+     */
+    template <class InputIterator>
+    size_t push_batch(InputIterator first, size_t count)
+    {
+        size_t position = tail.load(std::memory_order_relaxed);
+        size_t accepted = std::min(count, free_space(position, count));
+        for (size_t offset = 0; offset < accepted; ++offset, ++first)
+            ::new (static_cast<void *>(slots + ((position + offset) & mask))) T(*first);
+        if (accepted)
+            tail.store(position + accepted, std::memory_order_release);
+        return accepted;
+    }
+
+    /**
+     * Извлечение до max_count элементов в output
+     * @return сколько элементов извлечено
+     */
+    template <class OutputIterator>
+    size_t pop_batch(OutputIterator output, size_t max_count)
+    {
+        size_t position = head.load(std::memory_order_relaxed);
+        size_t taken = std::min(max_count, ready_count(position, max_count));
+        for (size_t offset = 0; offset < taken; ++offset, ++output)
+        {
+            T &slot = slots[(position + offset) & mask];
+            *output = std::move(slot);
+            std::destroy_at(&slot);
+        }
+        if (taken)
+            head.store(position + taken, std::memory_order_release);
+        return taken;
+    }
+
+    size_t capacity() const { return capacity_value; }
+
+    /** Приблизительный размер: при параллельной работе может уже измениться */
+    size_t size_approx() const
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+};
+
+/**
+ * Ограниченная очередь на кольцевом буфере: много производителей, много
+ * потребителей (MPMC, схема Дмитрия Вьюкова).
+ *
+ * У каждой ячейки свой номер sequence - он говорит, чья сейчас очередь:
+ * - sequence == позиция - ячейка свободна для производителя этого круга;
+ * - sequence == позиция + 1 - в ячейке элемент для потребителя;
+ * - после чтения sequence = позиция + емкость - ячейка свободна для
+ *   следующего круга.
+ * Производители соревнуются только за enqueue_position (CAS), потребители -
+ * за dequeue_position. Мьютексов нет, но очередь не lock-free в строгом
+ * смысле: поток, занявший ячейку и прерванный до записи sequence,
+ * задерживает тех, кто придет в эту ячейку за ним.
+ *
+ * По той же причине создание элемента в ячейке и перенос его наружу не
+ * должны бросать исключений: ячейка уже занята CAS, и если ее sequence не
+ * будет записан, try_pop навсегда увидит на этом месте пустую очередь, а
+ * pop_batch (или push_batch следующего круга) будет ждать ее вечно. Поэтому
+ * push требует noexcept-конструктора T, а pop - noexcept-присваивания.
+ *
+ * Пакетные операции занимают сразу несколько подряд идущих ячеек одним CAS.
+ */
+template <class T>
+class mpmc_queue
+{
+private:
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    const size_t capacity_value;
+    const size_t mask;
+    std::unique_ptr<cell[]> cells;
+
+    alignas(cache_line_size) std::atomic<size_t> enqueue_position{0};
+    alignas(cache_line_size) std::atomic<size_t> dequeue_position{0};
+
+    /** Ожидание, пока поток, занявший ячейку раньше, завершит с ней работу */
+    static void wait_for(const cell &target, size_t expected)
+    {
+        while (target.sequence.load(std::memory_order_acquire) != expected)
+            std::this_thread::yield();
+    }
+
+public:
+    /**
+     * @param capacity - емкость, округляется вверх до степени двойки
+     */
+    explicit mpmc_queue(size_t capacity)
+        : capacity_value(std::bit_ceil(std::max<size_t>(capacity, 2))),
+          mask(capacity_value - 1),
+          cells(new cell[capacity_value])
+    {
+        for (size_t index = 0; index < capacity_value; ++index)
+            cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+
+    mpmc_queue(const mpmc_queue &) = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+    ~mpmc_queue()
+    {
+        for (size_t position = dequeue_position.load(); position != enqueue_position.load(); ++position)
+            std::destroy_at(cells[position & mask].value());
+    }
+
+    template <class... Args>
+    bool try_emplace(Args &&...args)
+    {
+        static_assert(std::is_nothrow_constructible_v<T, Args &&...>,
+                      "mpmc_queue: создание элемента в занятой ячейке не должно бросать исключений");
+        size_t position = enqueue_position.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell &target = cells[position & mask];
+            size_t sequence = target.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0)
+            {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    ::new (static_cast<void *>(target.storage)) T(std::forward<Args>(args)...);
+                    target.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Ячейку еще не освободил потребитель прошлого круга - очередь полна
+            }
+            else
+            {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_push(const T &value) { return try_emplace(value); }
+    bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+    bool try_pop(T &value)
+    {
+        static_assert(std::is_nothrow_move_assignable_v<T>,
+                      "mpmc_queue: перенос элемента из ячейки не должен бросать исключений");
+        size_t position = dequeue_position.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell &target = cells[position & mask];
+            size_t sequence = target.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0)
+            {
+                if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = std::move(*target.value());
+                    std::destroy_at(target.value());
+                    target.sequence.store(position + capacity_value, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Элемент еще не записан - очередь пуста
+            }
+            else
+            {
+                position = dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Добавление до count элементов: подряд идущие ячейки занимаются одним
+     * CAS, затем заполняются по очереди
+     * @return сколько элементов поместилось
+     */
+    template <class InputIterator>
+    size_t push_batch(InputIterator first, size_t count)
+    {
+        static_assert(noexcept(T(*first)) && noexcept(++first),
+                      "mpmc_queue: создание элемента в занятой ячейке не должно бросать исключений");
+        size_t position = enqueue_position.load(std::memory_order_relaxed);
+        size_t accepted = 0;
+        for (;;)
+        {
+            if (cells[position & mask].sequence.load(std::memory_order_acquire) != position)
+            {
+                size_t current = enqueue_position.load(std::memory_order_relaxed);
+                if (current == position)
+                    return 0; // Первая ячейка занята - очередь полна
+                position = current;
+                continue;
+            }
+            // Занятые потребителями ячейки освобождаются, как только те закончат чтение
+            size_t consumed = dequeue_position.load(std::memory_order_acquire);
+            size_t used = position > consumed ? position - consumed : 0;
+            accepted = std::min(count, capacity_value - std::min(used, capacity_value));
+            if (accepted == 0)
+                return 0;
+            if (enqueue_position.compare_exchange_weak(position, position + accepted, std::memory_order_relaxed))
+                break;
+        }
+        for (size_t offset = 0; offset < accepted; ++offset, ++first)
+        {
+            cell &target = cells[(position + offset) & mask];
+            wait_for(target, position + offset);
+            ::new (static_cast<void *>(target.storage)) T(*first);
+            target.sequence.store(position + offset + 1, std::memory_order_release);
+        }
+        return accepted;
+    }
+
+    /**
+     * Извлечение до max_count элементов в output
+     * @return сколько элементов извлечено
+     */
+    template <class OutputIterator>
+    size_t pop_batch(OutputIterator output, size_t max_count)
+    {
+        static_assert(noexcept(*output = std::declval<T &&>()) && noexcept(++output),
+                      "mpmc_queue: перенос элемента из ячейки не должен бросать исключений");
+        size_t position = dequeue_position.load(std::memory_order_relaxed);
+        size_t taken = 0;
+        for (;;)
+        {
+            if (cells[position & mask].sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                size_t current = dequeue_position.load(std::memory_order_relaxed);
+                if (current == position)
+                    return 0; // Первый элемент еще не записан - очередь пуста
+                position = current;
+                continue;
+            }
+            // Ячейки, занятые производителями, будут записаны, как только те закончат
+            size_t produced = enqueue_position.load(std::memory_order_acquire);
+            taken = std::min(max_count, produced > position ? produced - position : 0);
+            if (taken == 0)
+                return 0;
+            if (dequeue_position.compare_exchange_weak(position, position + taken, std::memory_order_relaxed))
+                break;
+        }
+        for (size_t offset = 0; offset < taken; ++offset, ++output)
+        {
+            cell &target = cells[(position + offset) & mask];
+            wait_for(target, position + offset + 1);
+            *output = std::move(*target.value());
+            std::destroy_at(target.value());
+            target.sequence.store(position + offset + capacity_value, std::memory_order_release);
+        }
+        return taken;
+    }
+
+    size_t capacity() const { return capacity_value; }
+};